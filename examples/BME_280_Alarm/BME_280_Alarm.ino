@@ -0,0 +1,84 @@
+/*
+BME_280_Alarm.ino
+
+This code shows how to check pressure and humidity limits on raw
+samples. The limits are converted to raw values with the sensor's
+calibration, so most samples are checked with integer compares and
+only samples close to a limit are compensated.
+
+GNU General Public License
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+Connecting the BME280 Sensor:
+Sensor              ->  Board
+-----------------------------
+Vin (Voltage In)    ->  3.3V
+Gnd (Ground)        ->  Gnd
+SDA (Serial Data)   ->  A4 on Uno/Pro-Mini, 20 on Mega2560/Due, 2 Leonardo/Pro-Micro
+SCK (Serial Clock)  ->  A5 on Uno/Pro-Mini, 21 on Mega2560/Due, 3 Leonardo/Pro-Micro
+
+ */
+
+#include <BME280I2C.h>
+#include <BME280Alarm.h>
+#include <Wire.h>
+
+#define SERIAL_BAUD 115200
+
+BME280I2C bme;    // Default : forced mode, standby time = 1000 ms
+                  // Oversampling = pressure ×1, temperature ×1, humidity ×1, filter off,
+
+BME280Calibration calibration;
+BME280Alarm alarm(calibration);
+
+uint32_t checks = 0;
+
+//////////////////////////////////////////////////////////////////
+void setup()
+{
+  Serial.begin(SERIAL_BAUD);
+
+  while(!Serial) {} // Wait
+
+  Wire.begin();
+
+  while(!bme.begin())
+  {
+    Serial.println("Could not find BME280 sensor!");
+    delay(1000);
+  }
+
+  calibration.decode(bme.trim());
+
+  // 990 to 1030 hPa and 30 to 60 %RH.
+  alarm.setPressureLimits(99000UL * 256, 103000UL * 256);
+  alarm.setHumidityLimits(30UL * 1024, 60UL * 1024);
+}
+
+//////////////////////////////////////////////////////////////////
+void loop()
+{
+  int32_t pres, temp, hum;
+
+  if(bme.readRaw(pres, temp, hum))
+  {
+    uint8_t alarms = alarm.check(pres, temp, hum);
+    ++checks;
+
+    if(alarms & BME280Alarm::Alarm_PressureLow) { Serial.println("Pressure low"); }
+    if(alarms & BME280Alarm::Alarm_PressureHigh) { Serial.println("Pressure high"); }
+    if(alarms & BME280Alarm::Alarm_HumidityLow) { Serial.println("Humidity low"); }
+    if(alarms & BME280Alarm::Alarm_HumidityHigh) { Serial.println("Humidity high"); }
+
+    Serial.print(checks);
+    Serial.print(" checks, ");
+    Serial.print(alarm.compensations());
+    Serial.print(" compensated, ");
+    Serial.print(alarm.searches());
+    Serial.println(" searches");
+  }
+
+  delay(2000);
+}
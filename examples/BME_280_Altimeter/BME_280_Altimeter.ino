@@ -0,0 +1,91 @@
+/*
+BME_280_Altimeter.ino
+
+This code shows how to estimate altitude and vertical speed at the
+full output data rate of the sensor, about 145 Hz in normal mode with
+0.5 ms standby, pressure x1 and no humidity. Raw samples are
+compensated with BME280Calibration and filtered with BME280Altimeter,
+without any floating point per sample.
+
+GNU General Public License
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+Connecting the BME280 Sensor:
+Sensor              ->  Board
+-----------------------------
+Vin (Voltage In)    ->  3.3V
+Gnd (Ground)        ->  Gnd
+SDA (Serial Data)   ->  A4 on Uno/Pro-Mini, 20 on Mega2560/Due, 2 Leonardo/Pro-Micro
+SCK (Serial Clock)  ->  A5 on Uno/Pro-Mini, 21 on Mega2560/Due, 3 Leonardo/Pro-Micro
+
+ */
+
+#include <BME280I2C.h>
+#include <BME280Calibration.h>
+#include <BME280Altimeter.h>
+#include <Wire.h>
+
+#define SERIAL_BAUD 115200
+
+// The filter of the altimeter replaces the IIR filter of the sensor.
+BME280I2C bme(BME280I2C::Settings(BME280::OSR_X1, BME280::OSR_Off, BME280::OSR_X1,
+  BME280::Mode_Normal, BME280::StandbyTime_500us, BME280::Filter_Off));
+
+BME280Calibration calibration;
+
+// One measurement every 6925 µs at most: 1.25 ms + 2.3 ms for the
+// temperature + 2.3 ms + 0.575 ms for the pressure + 0.5 ms standby.
+// About 150 mm of noise per sample at pressure x1.
+#define PERIOD 6925
+
+BME280Altimeter altimeter(PERIOD, 150, BME280Altimeter::ACCELERATION_NOISE);
+
+uint32_t lastRead = 0;
+uint32_t lastPrint = 0;
+
+//////////////////////////////////////////////////////////////////
+void setup()
+{
+  Serial.begin(SERIAL_BAUD);
+
+  while(!Serial) {} // Wait
+
+  Wire.begin();
+  Wire.setClock(400000);
+
+  while(!bme.begin())
+  {
+    Serial.println("Could not find BME280 sensor!");
+    delay(1000);
+  }
+
+  calibration.decode(bme.trim());
+  altimeter.setReference(101325, 1500);
+}
+
+//////////////////////////////////////////////////////////////////
+void loop()
+{
+  // Read once per measurement.
+  if(micros() - lastRead < PERIOD) { return; }
+  lastRead = micros();
+
+  int32_t rawPressure, rawTemperature, rawHumidity, t_fine;
+  if(!bme.readRaw(rawPressure, rawTemperature, rawHumidity)) { return; }
+
+  calibration.temperature(rawTemperature, t_fine);
+  uint32_t pressure = calibration.pressure(rawPressure, t_fine);   // Pa * 256
+  altimeter.update(pressure, bme.sampleTime().measuredTime);
+
+  if(millis() - lastPrint >= 200)
+  {
+    lastPrint = millis();
+    Serial.print("Altitude: ");
+    Serial.print(altimeter.altitude() / 1000.0);
+    Serial.print(" m\t\tVertical speed: ");
+    Serial.print(altimeter.verticalSpeed() / 1000.0);
+    Serial.println(" m/s");
+  }
+}
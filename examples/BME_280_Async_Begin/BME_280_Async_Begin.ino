@@ -0,0 +1,107 @@
+/*
+BME_280_Async_Begin.ino
+
+This code shows how to initialize several BME280 sensors without
+blocking. Each sensor is reset and initialized by calling initStep()
+from loop(), so the waits for the reset and the filter priming
+measurement of all sensors overlap and loop() keeps running.
+
+GNU General Public License
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+Connecting the BME280 Sensors:
+Sensor              ->  Board
+-----------------------------
+Vin (Voltage In)    ->  3.3V
+Gnd (Ground)        ->  Gnd
+SDA (Serial Data)   ->  A4 on Uno/Pro-Mini, 20 on Mega2560/Due, 2 Leonardo/Pro-Micro
+SCK (Serial Clock)  ->  A5 on Uno/Pro-Mini, 21 on Mega2560/Due, 3 Leonardo/Pro-Micro
+SDO                 ->  Gnd on the first sensor, 3.3V on the second
+
+ */
+
+#include <BME280I2C.h>
+#include <Wire.h>
+
+#define SERIAL_BAUD 115200
+#define SENSOR_COUNT 2
+
+BME280I2C bmes[SENSOR_COUNT] =
+{
+  BME280I2C(BME280I2C::Settings(BME280::OSR_X1, BME280::OSR_X1, BME280::OSR_X1,
+    BME280::Mode_Normal, BME280::StandbyTime_1000ms, BME280::Filter_16,
+    BME280::SpiEnable_False, BME280I2C::I2CAddr_0x76)),
+  BME280I2C(BME280I2C::Settings(BME280::OSR_X1, BME280::OSR_X1, BME280::OSR_X1,
+    BME280::Mode_Normal, BME280::StandbyTime_1000ms, BME280::Filter_16,
+    BME280::SpiEnable_False, BME280I2C::I2CAddr_0x77))
+};
+
+unsigned long lastPrint = 0;
+unsigned long loops = 0;
+
+//////////////////////////////////////////////////////////////////
+void setup()
+{
+  Serial.begin(SERIAL_BAUD);
+
+  while(!Serial) {} // Wait
+
+  Wire.begin();
+
+  for(uint8_t i = 0; i < SENSOR_COUNT; ++i)
+  {
+    bmes[i].resetAsync();
+  }
+}
+
+//////////////////////////////////////////////////////////////////
+void loop()
+{
+  ++loops;
+
+  for(uint8_t i = 0; i < SENSOR_COUNT; ++i)
+  {
+    BME280::InitState state = bmes[i].initState();
+
+    if(state == BME280::InitState_Failed)
+    {
+      Serial.print("Sensor ");
+      Serial.print(i);
+      Serial.println(" failed, retrying.");
+      bmes[i].resetAsync();
+    }
+    else if(state != BME280::InitState_Ready)
+    {
+      if(bmes[i].initStep() == BME280::InitState_Ready)
+      {
+        Serial.print("Sensor ");
+        Serial.print(i);
+        Serial.print(" ready after ");
+        Serial.print(loops);
+        Serial.println(" loops.");
+      }
+    }
+  }
+
+  if(millis() - lastPrint >= 2000)
+  {
+    lastPrint = millis();
+
+    for(uint8_t i = 0; i < SENSOR_COUNT; ++i)
+    {
+      if(bmes[i].initState() != BME280::InitState_Ready) { continue; }
+
+      Serial.print("Sensor ");
+      Serial.print(i);
+      Serial.print(": ");
+      Serial.print(bmes[i].temp());
+      Serial.print("°C\t");
+      Serial.print(bmes[i].pres());
+      Serial.print("hPa\t");
+      Serial.print(bmes[i].hum());
+      Serial.println("% RH");
+    }
+  }
+}
@@ -0,0 +1,109 @@
+/*
+BME_280_Compressed_Telemetry.ino
+
+This code shows how to pack BME280 samples into small packets with
+BME280Codec.h for a low bandwidth link such as LoRa. The packet is
+printed in hex where a radio would send it, then decoded again the
+way a receiver would.
+
+GNU General Public License
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+Connecting the BME280 Sensor:
+Sensor              ->  Board
+-----------------------------
+Vin (Voltage In)    ->  3.3V
+Gnd (Ground)        ->  Gnd
+SDA (Serial Data)   ->  A4 on Uno/Pro-Mini, 20 on Mega2560/Due, 2 Leonardo/Pro-Micro
+SCK (Serial Clock)  ->  A5 on Uno/Pro-Mini, 21 on Mega2560/Due, 3 Leonardo/Pro-Micro
+
+ */
+
+#include <BME280I2C.h>
+#include <BME280Codec.h>
+#include <Wire.h>
+
+#define SERIAL_BAUD 115200
+#define PACKET_SIZE 51     // LoRaWAN payload limit at the slowest data rate.
+
+BME280I2C bme;    // Default : forced mode, standby time = 1000 ms
+                  // Oversampling = pressure ×1, temperature ×1, humidity ×1, filter off,
+
+BME280Encoder encoder;
+BME280Decoder decoder;
+
+uint8_t packet[PACKET_SIZE];
+uint8_t packetLength = 0;
+
+//////////////////////////////////////////////////////////////////
+void setup()
+{
+  Serial.begin(SERIAL_BAUD);
+
+  while(!Serial) {} // Wait
+
+  Wire.begin();
+
+  while(!bme.begin())
+  {
+    Serial.println("Could not find BME280 sensor!");
+    delay(1000);
+  }
+}
+
+//////////////////////////////////////////////////////////////////
+void loop()
+{
+  uint32_t pres, hum;
+  int32_t temp;
+
+  if(bme.read(pres, temp, hum))
+  {
+    uint8_t frame[BME280Encoder::MAX_FRAME_LENGTH];
+    uint8_t length = encoder.encode(frame, pres, temp, hum);
+
+    if(packetLength + length > PACKET_SIZE)
+    {
+      sendPacket();
+    }
+
+    memcpy(&packet[packetLength], frame, length);
+    packetLength += length;
+  }
+
+  delay(1000);
+}
+
+//////////////////////////////////////////////////////////////////
+void sendPacket()
+{
+  Serial.print("Packet: ");
+  for(uint8_t i = 0; i < packetLength; ++i)
+  {
+    if(packet[i] < 0x10) { Serial.print('0'); }
+    Serial.print(packet[i], HEX);
+  }
+  Serial.println();
+
+  // Receiver side.
+  size_t ord = 0, consumed;
+  int32_t pres, temp, hum;
+  bool valid;
+  while((consumed = decoder.decode(&packet[ord], packetLength - ord, pres, temp, hum, valid)) != 0)
+  {
+    ord += consumed;
+    if(!valid) { continue; }
+
+    Serial.print("Temp: ");
+    Serial.print(temp / 100.0);
+    Serial.print("°C\t\tHumidity: ");
+    Serial.print(hum / 1024.0);
+    Serial.print("% RH\t\tPressure: ");
+    Serial.print(pres);
+    Serial.println(" Pa");
+  }
+
+  packetLength = 0;
+}
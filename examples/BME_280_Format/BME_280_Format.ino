@@ -0,0 +1,80 @@
+/*
+BME_280_Format.ino
+
+This code shows how to write samples as CSV, JSON and InfluxDB line
+protocol into a fixed buffer, without printf, String or heap memory.
+
+GNU General Public License
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+Connecting the BME280 Sensor:
+Sensor              ->  Board
+-----------------------------
+Vin (Voltage In)    ->  3.3V
+Gnd (Ground)        ->  Gnd
+SDA (Serial Data)   ->  A4 on Uno/Pro-Mini, 20 on Mega2560/Due, 2 Leonardo/Pro-Micro
+SCK (Serial Clock)  ->  A5 on Uno/Pro-Mini, 21 on Mega2560/Due, 3 Leonardo/Pro-Micro
+
+ */
+
+#include <BME280I2C.h>
+#include <BME280Format.h>
+#include <Wire.h>
+
+#define SERIAL_BAUD 115200
+
+BME280I2C bme;    // Default : forced mode, standby time = 1000 ms
+                  // Oversampling = pressure ×1, temperature ×1, humidity ×1, filter off,
+
+char buffer[96];
+BME280Format csv(buffer, sizeof(buffer));
+
+//////////////////////////////////////////////////////////////////
+void setup()
+{
+  Serial.begin(SERIAL_BAUD);
+
+  while(!Serial) {} // Wait
+
+  Wire.begin();
+
+  while(!bme.begin())
+  {
+    Serial.println("Could not find BME280 sensor!");
+    delay(1000);
+  }
+
+  csv.header();
+  Serial.println(csv.c_str());
+}
+
+//////////////////////////////////////////////////////////////////
+void loop()
+{
+  uint32_t pres, hum;
+  int32_t temp;
+
+  if(bme.read(pres, temp, hum))
+  {
+    // Integer results are converted to the units in fixed point.
+    csv.clear();
+    csv.appendInteger(millis());
+    csv.append(",");
+    csv.sample(pres, temp, hum);
+    Serial.println(csv.c_str());
+
+    BME280Format json(buffer, sizeof(buffer), BME280Format::Format_Json,
+      BME280::TempUnit_Fahrenheit, BME280::PresUnit_inHg);
+    json.sample(pres, temp, hum);
+    Serial.println(json.c_str());
+
+    BME280Format influx(buffer, sizeof(buffer), BME280Format::Format_Influx);
+    influx.setMeasurement("bme280", "room=lab");
+    influx.sample(pres, temp, hum);
+    Serial.println(influx.c_str());
+  }
+
+  delay(5000);
+}
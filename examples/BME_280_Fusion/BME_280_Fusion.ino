@@ -0,0 +1,106 @@
+/*
+BME_280_Fusion.ino
+
+This code shows how to read three redundant BME280 sensors, two on
+I2C and one on SPI, as one. The three conversions run at the same
+time, outliers are voted out and constant offsets between the sensors
+are learned.
+
+GNU General Public License
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+Connecting the BME280 Sensors:
+Sensor              ->  Board
+-----------------------------
+Vin (Voltage In)    ->  3.3V
+Gnd (Ground)        ->  Gnd
+SDA (Serial Data)   ->  A4 on Uno/Pro-Mini, 20 on Mega2560/Due, 2 Leonardo/Pro-Micro
+SCK (Serial Clock)  ->  A5 on Uno/Pro-Mini, 21 on Mega2560/Due, 3 Leonardo/Pro-Micro
+SDO                 ->  Gnd on the first sensor, 3.3V on the second
+The third sensor on the SPI bus with chip select on pin 10.
+
+ */
+
+#include <SPI.h>
+#include <Wire.h>
+#include <BME280I2C.h>
+#include <BME280Spi.h>
+#include <BME280Fusion.h>
+
+#define SERIAL_BAUD 115200
+#define DEVICE_PIN 10
+#define SENSOR_COUNT 3
+
+// Forced mode, every read of the group is one conversion.
+BME280I2C bme76(BME280I2C::Settings(BME280::OSR_X2, BME280::OSR_X1, BME280::OSR_X4,
+  BME280::Mode_Forced, BME280::StandbyTime_1000ms, BME280::Filter_Off,
+  BME280::SpiEnable_False, BME280I2C::I2CAddr_0x76));
+BME280I2C bme77(BME280I2C::Settings(BME280::OSR_X2, BME280::OSR_X1, BME280::OSR_X4,
+  BME280::Mode_Forced, BME280::StandbyTime_1000ms, BME280::Filter_Off,
+  BME280::SpiEnable_False, BME280I2C::I2CAddr_0x77));
+BME280Spi bmeSpi(BME280Spi::Settings(DEVICE_PIN, BME280::OSR_X2, BME280::OSR_X1, BME280::OSR_X4));
+
+BME280* sensors[SENSOR_COUNT] = { &bme76, &bme77, &bmeSpi };
+BME280Fusion fusion(sensors, SENSOR_COUNT);
+
+const char* const healths[] = { "ok", "degraded", "unverified", "failed" };
+
+//////////////////////////////////////////////////////////////////
+void setup()
+{
+  Serial.begin(SERIAL_BAUD);
+
+  while(!Serial) {} // Wait
+
+  Wire.begin();
+  SPI.begin();
+
+  for(uint8_t i = 0; i < SENSOR_COUNT; ++i)
+  {
+    if(!sensors[i]->begin())
+    {
+      Serial.print("Could not find sensor ");
+      Serial.println(i);
+    }
+  }
+}
+
+//////////////////////////////////////////////////////////////////
+void loop()
+{
+  BME280Fusion::Sample sample;
+
+  if(fusion.read(sample))
+  {
+    Serial.print("Temp: ");
+    Serial.print(sample.temperature / 100.0);
+    Serial.print("°C\t\tHumidity: ");
+    Serial.print(sample.humidity / 1024.0);
+    Serial.print("% RH\t\tPressure: ");
+    Serial.print(sample.pressure);
+    Serial.print(" Pa\t\t");
+  }
+
+  Serial.print("Health: ");
+  Serial.println(healths[sample.health]);
+
+  for(uint8_t i = 0; i < SENSOR_COUNT; ++i)
+  {
+    if((sample.failed | sample.rejected) & (1 << i))
+    {
+      BME280Fusion::SensorStatus status = fusion.status(i);
+      Serial.print("  sensor ");
+      Serial.print(i);
+      Serial.print(sample.failed & (1 << i) ? " failed" : " rejected");
+      Serial.print(", temperature bias ");
+      Serial.print(status.temperatureBias / 100.0);
+      Serial.print("°C, pressure bias ");
+      Serial.print(status.pressureBias);
+      Serial.println(" Pa");
+    }
+  }
+
+  delay(1000);
+}
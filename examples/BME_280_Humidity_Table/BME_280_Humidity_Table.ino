@@ -0,0 +1,139 @@
+/*
+BME_280_Humidity_Table.ino
+
+This code benchmarks table-driven humidity compensation against the
+Bosch formula for the connected sensor's calibration. For each table
+size it prints the memory used, the maximum and mean error over
+-40..85 °C and 0..100 %RH, and the time per call in microseconds and
+CPU cycles.
+
+GNU General Public License
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+Connecting the BME280 Sensor:
+Sensor              ->  Board
+-----------------------------
+Vin (Voltage In)    ->  3.3V
+Gnd (Ground)        ->  Gnd
+SDA (Serial Data)   ->  A4 on Uno/Pro-Mini, 20 on Mega2560/Due, 2 Leonardo/Pro-Micro
+SCK (Serial Clock)  ->  A5 on Uno/Pro-Mini, 21 on Mega2560/Due, 3 Leonardo/Pro-Micro
+
+ */
+
+#include <BME280I2C.h>
+#include <BME280Calibration.h>
+#include <Wire.h>
+
+#define SERIAL_BAUD 115200
+
+const uint8_t SIZES[][2] = { { 4, 8 }, { 8, 16 }, { 16, 32 } };
+const int TIMING_CALLS = 1000;
+
+int16_t table[16 * 32];
+
+volatile uint32_t sink;    // Keeps the timed calls from being optimized out.
+
+BME280I2C bme;    // Default : forced mode, standby time = 1000 ms
+                  // Oversampling = pressure ×1, temperature ×1, humidity ×1, filter off,
+
+//////////////////////////////////////////////////////////////////
+void setup()
+{
+  Serial.begin(SERIAL_BAUD);
+
+  while(!Serial) {} // Wait
+
+  Wire.begin();
+
+  while(!bme.begin())
+  {
+    Serial.println("Could not find BME280 sensor!");
+    delay(1000);
+  }
+
+  BME280Calibration calibration(bme.trim());
+
+  for(uint8_t i = 0; i < sizeof(SIZES) / sizeof(SIZES[0]); ++i)
+  {
+    BME280HumidityTable humidityTable;
+    humidityTable.build(calibration, table, SIZES[i][0], SIZES[i][1]);
+
+    // t_fine from -40 to 85 °C, compared where the formula is not clamped.
+    uint32_t maxError = 0, count = 0;
+    float sumError = 0;
+    for(int32_t t_fine = -204800; t_fine <= 435200; t_fine += 6400)
+    {
+      for(int32_t raw = 0; raw < 65536; raw += 256)
+      {
+        uint32_t expected = calibration.humidity(raw, t_fine);
+        if(expected == 0 || expected == 102400) { continue; }
+
+        uint32_t actual = humidityTable.humidity(raw, t_fine);
+        uint32_t error = actual > expected ? actual - expected : expected - actual;
+        if(error > maxError) { maxError = error; }
+        sumError += error;
+        ++count;
+      }
+    }
+
+    Serial.print(SIZES[i][0]);
+    Serial.print("x");
+    Serial.print(SIZES[i][1]);
+    Serial.print(" table, ");
+    Serial.print(SIZES[i][0] * SIZES[i][1] * sizeof(int16_t));
+    Serial.print(" bytes: max error ");
+    Serial.print(maxError / 1024.0, 3);
+    Serial.print(" %RH, mean error ");
+    Serial.print(sumError / count / 1024.0, 4);
+    Serial.print(" %RH, ");
+    printTime(timeTable(humidityTable));
+  }
+
+  Serial.print("Formula: ");
+  printTime(timeFormula(calibration));
+}
+
+//////////////////////////////////////////////////////////////////
+void loop()
+{
+}
+
+//////////////////////////////////////////////////////////////////
+void printTime(float us)
+{
+  Serial.print(us);
+  Serial.print(" us/call, ");
+  Serial.print(us * (F_CPU / 1000000UL), 0);
+  Serial.println(" cycles/call");
+}
+
+//////////////////////////////////////////////////////////////////
+// Times calls around 25 °C and 50 %RH.
+float timeFormula(const BME280Calibration& calibration)
+{
+  uint32_t sum = 0;
+  unsigned long start = micros();
+  for(int i = 0; i < TIMING_CALLS; ++i)
+  {
+    sum += calibration.humidity(30000 + i, 128000 + i);
+  }
+  unsigned long elapsed = micros() - start;
+  sink = sum;
+  return (float)elapsed / TIMING_CALLS;
+}
+
+//////////////////////////////////////////////////////////////////
+float timeTable(const BME280HumidityTable& humidityTable)
+{
+  uint32_t sum = 0;
+  unsigned long start = micros();
+  for(int i = 0; i < TIMING_CALLS; ++i)
+  {
+    sum += humidityTable.humidity(30000 + i, 128000 + i);
+  }
+  unsigned long elapsed = micros() - start;
+  sink = sum;
+  return (float)elapsed / TIMING_CALLS;
+}
@@ -0,0 +1,89 @@
+/*
+BME_280_Raw_Log.ino
+
+This code shows how to log raw BME280 samples to an SD card in the
+compact binary format of BME280Log.h. The samples are compensated
+later, on the host or on the target, from the calibration stored in
+the log header.
+
+GNU General Public License
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+Connecting the BME280 Sensor:
+Sensor              ->  Board
+-----------------------------
+Vin (Voltage In)    ->  3.3V
+Gnd (Ground)        ->  Gnd
+SDA (Serial Data)   ->  A4 on Uno/Pro-Mini, 20 on Mega2560/Due, 2 Leonardo/Pro-Micro
+SCK (Serial Clock)  ->  A5 on Uno/Pro-Mini, 21 on Mega2560/Due, 3 Leonardo/Pro-Micro
+
+The SD card is connected to the hardware SPI pins with chip select on SD_CS_PIN.
+
+ */
+
+#include <BME280I2C.h>
+#include <BME280Log.h>
+#include <SD.h>
+#include <Wire.h>
+
+#define SERIAL_BAUD 115200
+#define SD_CS_PIN 4
+
+BME280I2C bme;    // Default : forced mode, standby time = 1000 ms
+                  // Oversampling = pressure ×1, temperature ×1, humidity ×1, filter off,
+
+BME280LogWriter logWriter;
+File logFile;
+
+//////////////////////////////////////////////////////////////////
+void setup()
+{
+  Serial.begin(SERIAL_BAUD);
+
+  while(!Serial) {} // Wait
+
+  Wire.begin();
+
+  while(!bme.begin())
+  {
+    Serial.println("Could not find BME280 sensor!");
+    delay(1000);
+  }
+
+  while(!SD.begin(SD_CS_PIN))
+  {
+    Serial.println("Could not find SD card!");
+    delay(1000);
+  }
+
+  logFile = SD.open("bme280.log", FILE_WRITE);
+
+  // The header carries everything needed to compensate the raw records.
+  BME280LogHeader header;
+  header.chipModel = bme.chipModel();
+  bme.registers(header.ctrlHum, header.ctrlMeas, header.config);
+  header.timeResolution = 1000;    // millis()
+  header.startTime = millis();
+  memcpy(header.trim, bme.trim(), sizeof(header.trim));
+
+  uint8_t buffer[BME280LogWriter::HEADER_LENGTH];
+  logFile.write(buffer, logWriter.writeHeader(buffer, header));
+  logFile.flush();
+}
+
+//////////////////////////////////////////////////////////////////
+void loop()
+{
+   uint8_t data[8];
+
+   if(bme.readRaw(data))
+   {
+      uint8_t buffer[BME280LogWriter::MAX_RECORD_LENGTH];
+      logFile.write(buffer, logWriter.writeRecord(buffer, data, millis()));
+      logFile.flush();
+   }
+
+   delay(1000);
+}
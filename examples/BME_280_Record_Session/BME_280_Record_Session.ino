@@ -0,0 +1,74 @@
+/*
+BME_280_Record_Session.ino
+
+This code shows how to record the bus session of a BME280 with
+BME280Recorder: begin() and as many reads as fit in the buffer. The
+session is then printed in hex, to be replayed on a host with
+extras/host/bme280_session_replay.
+
+GNU General Public License
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+Connecting the BME280 Sensor:
+Sensor              ->  Board
+-----------------------------
+Vin (Voltage In)    ->  3.3V
+Gnd (Ground)        ->  Gnd
+SDA (Serial Data)   ->  A4 on Uno/Pro-Mini, 20 on Mega2560/Due, 2 Leonardo/Pro-Micro
+SCK (Serial Clock)  ->  A5 on Uno/Pro-Mini, 21 on Mega2560/Due, 3 Leonardo/Pro-Micro
+
+ */
+
+#include <BME280I2C.h>
+#include <BME280Recorder.h>
+#include <Wire.h>
+
+#define SERIAL_BAUD 115200
+#define SESSION_SIZE 1024
+
+uint8_t session[SESSION_SIZE];
+
+BME280Recorder<BME280I2C> bme(session, SESSION_SIZE);
+                  // Default : forced mode, standby time = 1000 ms
+                  // Oversampling = pressure ×1, temperature ×1, humidity ×1, filter off,
+
+//////////////////////////////////////////////////////////////////
+void setup()
+{
+  Serial.begin(SERIAL_BAUD);
+
+  while(!Serial) {} // Wait
+
+  Wire.begin();
+
+  while(!bme.begin())
+  {
+    Serial.println("Could not find BME280 sensor!");
+    bme.session().clear();
+    delay(1000);
+  }
+
+  // The last read may be cut short when the buffer fills up.
+  float temp, hum, pres;
+  while(!bme.session().overflow())
+  {
+    bme.read(pres, temp, hum);
+    delay(1000);
+  }
+
+  // Copy the output into session.hex and convert it with: xxd -r -p session.hex session.bin
+  for(size_t i = 0; i < bme.session().length(); ++i)
+  {
+    if(session[i] < 0x10) { Serial.print('0'); }
+    Serial.print(session[i], HEX);
+    if(i % 32 == 31) { Serial.println(); }
+  }
+  Serial.println();
+}
+
+//////////////////////////////////////////////////////////////////
+void loop()
+{
+}
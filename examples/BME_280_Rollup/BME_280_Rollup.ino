@@ -0,0 +1,120 @@
+/*
+BME_280_Rollup.ino
+
+This code shows how to keep a week of pressure and temperature history
+at three resolutions: an hour of minutes, a day of 15 minutes and a
+week of hours, in about 5 KB.
+
+GNU General Public License
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+Connecting the BME280 Sensor:
+Sensor              ->  Board
+-----------------------------
+Vin (Voltage In)    ->  3.3V
+Gnd (Ground)        ->  Gnd
+SDA (Serial Data)   ->  A4 on Uno/Pro-Mini, 20 on Mega2560/Due, 2 Leonardo/Pro-Micro
+SCK (Serial Clock)  ->  A5 on Uno/Pro-Mini, 21 on Mega2560/Due, 3 Leonardo/Pro-Micro
+
+ */
+
+#include <BME280I2C.h>
+#include <BME280Rollup.h>
+#include <Wire.h>
+
+#define SERIAL_BAUD 115200
+
+BME280I2C bme;    // Default : forced mode, standby time = 1000 ms
+                  // Oversampling = pressure ×1, temperature ×1, humidity ×1, filter off,
+
+BME280RollupBucket presMinutes[60], presQuarters[96], presHours[168];
+BME280RollupBucket tempMinutes[60], tempQuarters[96], tempHours[168];
+
+const BME280RollupLevel presLevels[] = {
+  { presMinutes, 60, 60 },
+  { presQuarters, 96, 15 * 60UL },
+  { presHours, 168, 60 * 60UL }
+};
+const BME280RollupLevel tempLevels[] = {
+  { tempMinutes, 60, 60 },
+  { tempQuarters, 96, 15 * 60UL },
+  { tempHours, 168, 60 * 60UL }
+};
+
+BME280Rollup pressure(presLevels, 3, 100000);   // Pa around 1000 hPa
+BME280Rollup temperature(tempLevels, 3);        // 0.01 °C
+
+uint32_t lastPrint = 0;
+
+//////////////////////////////////////////////////////////////////
+void setup()
+{
+  Serial.begin(SERIAL_BAUD);
+
+  while(!Serial) {} // Wait
+
+  Wire.begin();
+
+  while(!bme.begin())
+  {
+    Serial.println("Could not find BME280 sensor!");
+    delay(1000);
+  }
+}
+
+//////////////////////////////////////////////////////////////////
+void loop()
+{
+  uint32_t pres, hum;
+  int32_t temp;
+  uint32_t now = millis() / 1000;
+
+  if(bme.read(pres, temp, hum))
+  {
+    pressure.add(pres, now);
+    temperature.add(temp, now);
+  }
+
+  if(now - lastPrint >= 60)
+  {
+    lastPrint = now;
+    printRange("Last hour", now > 3600 ? now - 3600 : 0, now + 1);
+    printRange("Last day ", now > 86400UL ? now - 86400UL : 0, now + 1);
+  }
+
+  delay(1000);
+}
+
+//////////////////////////////////////////////////////////////////
+void printRange
+(
+   const char* name,
+   uint32_t from,
+   uint32_t to
+)
+{
+   BME280Rollup::Summary p, t;
+   if(!pressure.query(from, to, p) || !temperature.query(from, to, t))
+   {
+      return;
+   }
+
+   Serial.print(name);
+   Serial.print(": pressure ");
+   Serial.print(p.mean);
+   Serial.print(" Pa (");
+   Serial.print(p.min);
+   Serial.print(" to ");
+   Serial.print(p.max);
+   Serial.print(")\ttemperature ");
+   Serial.print(t.mean / 100.0);
+   Serial.print(" °C (");
+   Serial.print(t.min / 100.0);
+   Serial.print(" to ");
+   Serial.print(t.max / 100.0);
+   Serial.print(")\t");
+   Serial.print(p.count);
+   Serial.println(" samples");
+}
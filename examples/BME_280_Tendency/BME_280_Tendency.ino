@@ -0,0 +1,104 @@
+/*
+BME_280_Tendency.ino
+
+This code shows how to track the pressure tendency over two horizons,
+the 3 hour WMO tendency and the rate of the last 10 minutes, in a few
+hundred bytes whatever the sample rate.
+
+GNU General Public License
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+Connecting the BME280 Sensor:
+Sensor              ->  Board
+-----------------------------
+Vin (Voltage In)    ->  3.3V
+Gnd (Ground)        ->  Gnd
+SDA (Serial Data)   ->  A4 on Uno/Pro-Mini, 20 on Mega2560/Due, 2 Leonardo/Pro-Micro
+SCK (Serial Clock)  ->  A5 on Uno/Pro-Mini, 21 on Mega2560/Due, 3 Leonardo/Pro-Micro
+
+ */
+
+#include <BME280I2C.h>
+#include <BME280Tendency.h>
+#include <Wire.h>
+
+#define SERIAL_BAUD 115200
+
+BME280I2C bme;    // Default : forced mode, standby time = 1000 ms
+                  // Oversampling = pressure ×1, temperature ×1, humidity ×1, filter off,
+
+// 12 buckets of 15 minutes for 3 hours, 10 buckets of 1 minute.
+BME280TendencyBucket hoursBuckets[12];
+BME280TendencyBucket minutesBuckets[10];
+BME280Tendency hours(hoursBuckets, 12, 15 * 60UL);
+BME280Tendency minutes(minutesBuckets, 10, 60UL);
+
+const char* const characteristics[] = {
+  "rising, then falling",
+  "rising, then steady",
+  "rising",
+  "falling or steady, then rising",
+  "steady",
+  "falling, then rising",
+  "falling, then steady",
+  "falling",
+  "steady or rising, then falling"
+};
+
+//////////////////////////////////////////////////////////////////
+void setup()
+{
+  Serial.begin(SERIAL_BAUD);
+
+  while(!Serial) {} // Wait
+
+  Wire.begin();
+
+  while(!bme.begin())
+  {
+    Serial.println("Could not find BME280 sensor!");
+    delay(1000);
+  }
+}
+
+//////////////////////////////////////////////////////////////////
+void loop()
+{
+  uint32_t pres, hum;
+  int32_t temp;
+
+  if(bme.read(pres, temp, hum))
+  {
+    uint32_t now = millis() / 1000;
+    hours.add(pres, now);
+    minutes.add(pres, now);
+
+    BME280Tendency::Stats stats;
+    if(minutes.stats(stats))
+    {
+      Serial.print("Pressure: ");
+      Serial.print(stats.mean);
+      Serial.print(" Pa\t\tRate: ");
+      Serial.print(stats.slope);
+      Serial.print(" Pa/h\t\t");
+    }
+
+    int32_t change;
+    uint8_t characteristic;
+    if(hours.tendency(change, characteristic))
+    {
+      Serial.print("3h: ");
+      Serial.print(change);
+      Serial.print(" Pa, ");
+      Serial.println(characteristics[characteristic]);
+    }
+    else
+    {
+      Serial.println("3h: collecting");
+    }
+  }
+
+  delay(5000);
+}
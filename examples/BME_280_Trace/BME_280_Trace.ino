@@ -0,0 +1,115 @@
+/*
+BME_280_Trace.ino
+
+This code shows how to capture a timing trace of every register access
+and sample phase. The sink only stores events in an array, up to
+TRACE_SIZE per read, and drops the rest so the start of the read is
+kept. The array is printed after the read so printing does not change
+the timing being traced.
+
+Build the library with BME280_TRACE defined to enable the trace calls,
+and optionally BME280_TRACE_TIMESTAMP() defined as a cycle counter,
+e.g. ESP.getCycleCount() on ESP8266/ESP32. Without BME280_TRACE the
+sketch runs but records nothing.
+
+GNU General Public License
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+Connecting the BME280 Sensor:
+Sensor              ->  Board
+-----------------------------
+Vin (Voltage In)    ->  3.3V
+Gnd (Ground)        ->  Gnd
+SDA (Serial Data)   ->  A4 on Uno/Pro-Mini, 20 on Mega2560/Due, 2 Leonardo/Pro-Micro
+SCK (Serial Clock)  ->  A5 on Uno/Pro-Mini, 21 on Mega2560/Due, 3 Leonardo/Pro-Micro
+
+ */
+
+#include <BME280I2C.h>
+#include <Wire.h>
+
+#define SERIAL_BAUD 115200
+#define TRACE_SIZE 64
+
+struct TraceEntry
+{
+  uint32_t timestamp;
+  uint8_t event;
+  uint8_t addr;
+  uint8_t length;
+};
+
+const char* EVENT_NAMES[] =
+{
+  "Write+", "Write-", "Read+", "Read-", "Trigger+", "Trigger-",
+  "Wait+", "Wait-", "Burst+", "Burst-", "Compensate+", "Compensate-"
+};
+
+TraceEntry trace[TRACE_SIZE];
+uint8_t traceCount = 0;
+
+BME280I2C bme;    // Default : forced mode, standby time = 1000 ms
+                  // Oversampling = pressure ×1, temperature ×1, humidity ×1, filter off,
+
+//////////////////////////////////////////////////////////////////
+void BME280TraceSink
+(
+  const BME280& sensor,
+  BME280::TraceEvent event,
+  uint32_t timestamp,
+  uint8_t addr,
+  uint8_t length
+)
+{
+  if(traceCount < TRACE_SIZE)
+  {
+    TraceEntry& entry = trace[traceCount++];
+    entry.timestamp = timestamp;
+    entry.event = event;
+    entry.addr = addr;
+    entry.length = length;
+  }
+}
+
+//////////////////////////////////////////////////////////////////
+void setup()
+{
+  Serial.begin(SERIAL_BAUD);
+
+  while(!Serial) {} // Wait
+
+  Wire.begin();
+
+  while(!bme.begin())
+  {
+    Serial.println("Could not find BME280 sensor!");
+    delay(1000);
+  }
+}
+
+//////////////////////////////////////////////////////////////////
+void loop()
+{
+  uint32_t pres, hum;
+  int32_t temp;
+
+  traceCount = 0;
+  bme.read(pres, temp, hum);
+
+  uint32_t start = traceCount ? trace[0].timestamp : 0;
+  for(uint8_t i = 0; i < traceCount; ++i)
+  {
+    Serial.print(trace[i].timestamp - start);
+    Serial.print("\t");
+    Serial.print(EVENT_NAMES[trace[i].event]);
+    Serial.print("\t0x");
+    Serial.print(trace[i].addr, HEX);
+    Serial.print("\t");
+    Serial.println(trace[i].length);
+  }
+  Serial.println();
+
+  delay(5000);
+}
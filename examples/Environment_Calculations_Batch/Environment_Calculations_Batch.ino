@@ -0,0 +1,117 @@
+/*
+Environment_Calculations_Batch.ino
+
+This code benchmarks the batch environment calculations against
+the scalar functions on a block of synthetic samples.
+
+GNU General Public License
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+No sensor is needed, the samples are generated.
+
+ */
+
+#include <EnvironmentCalculations.h>
+
+#define SERIAL_BAUD 115200
+
+const size_t SAMPLE_COUNT = 64;
+
+float temp[SAMPLE_COUNT];
+float hum[SAMPLE_COUNT];
+float pres[SAMPLE_COUNT];
+float result[SAMPLE_COUNT];
+
+float referencePressure = 1018.6;  // hPa local QFF
+float outdoorTemp = 4.7;           // °C  measured local outdoor temp.
+float barometerAltitude = 1650.3;  // meters
+
+//////////////////////////////////////////////////////////////////
+void setup()
+{
+  Serial.begin(SERIAL_BAUD);
+
+  while(!Serial) {} // Wait
+
+  for(size_t i = 0; i < SAMPLE_COUNT; ++i)
+  {
+    temp[i] = -10.0 + 0.7 * i;   // °C
+    hum[i]  = 20.0 + 1.1 * i;    // %RH
+    pres[i] = 850.0 + 2.5 * i;   // hPa
+  }
+}
+
+//////////////////////////////////////////////////////////////////
+void loop()
+{
+   uint32_t start, scalar, batch;
+
+   Serial.print("Samples: ");
+   Serial.println(SAMPLE_COUNT);
+
+   start = micros();
+   for(size_t i = 0; i < SAMPLE_COUNT; ++i)
+     result[i] = EnvironmentCalculations::Altitude(pres[i], EnvironmentCalculations::AltitudeUnit_Meters, referencePressure, outdoorTemp);
+   scalar = micros() - start;
+   start = micros();
+   EnvironmentCalculations::Altitude(pres, result, SAMPLE_COUNT, EnvironmentCalculations::AltitudeUnit_Meters, referencePressure, outdoorTemp);
+   batch = micros() - start;
+   printResult("Altitude", scalar, batch);
+
+   start = micros();
+   for(size_t i = 0; i < SAMPLE_COUNT; ++i)
+     result[i] = EnvironmentCalculations::DewPoint(temp[i], hum[i]);
+   scalar = micros() - start;
+   start = micros();
+   EnvironmentCalculations::DewPoint(temp, hum, result, SAMPLE_COUNT);
+   batch = micros() - start;
+   printResult("DewPoint", scalar, batch);
+
+   start = micros();
+   for(size_t i = 0; i < SAMPLE_COUNT; ++i)
+     result[i] = EnvironmentCalculations::AbsoluteHumidity(temp[i], hum[i], EnvironmentCalculations::TempUnit_Celsius);
+   scalar = micros() - start;
+   start = micros();
+   EnvironmentCalculations::AbsoluteHumidity(temp, hum, result, SAMPLE_COUNT);
+   batch = micros() - start;
+   printResult("AbsoluteHumidity", scalar, batch);
+
+   start = micros();
+   for(size_t i = 0; i < SAMPLE_COUNT; ++i)
+     result[i] = EnvironmentCalculations::HeatIndex(temp[i], hum[i]);
+   scalar = micros() - start;
+   start = micros();
+   EnvironmentCalculations::HeatIndex(temp, hum, result, SAMPLE_COUNT);
+   batch = micros() - start;
+   printResult("HeatIndex", scalar, batch);
+
+   start = micros();
+   for(size_t i = 0; i < SAMPLE_COUNT; ++i)
+     result[i] = EnvironmentCalculations::EquivalentSeaLevelPressure(barometerAltitude, temp[i], pres[i]);
+   scalar = micros() - start;
+   start = micros();
+   EnvironmentCalculations::EquivalentSeaLevelPressure(barometerAltitude, temp, pres, result, SAMPLE_COUNT);
+   batch = micros() - start;
+   printResult("EquivalentSeaLevelPressure", scalar, batch);
+
+   Serial.println("***************************************");
+   delay(5000);
+}
+
+//////////////////////////////////////////////////////////////////
+void printResult
+(
+   const char* name,
+   uint32_t scalar,
+   uint32_t batch
+)
+{
+   Serial.print(name);
+   Serial.print("\t\tScalar: ");
+   Serial.print(scalar);
+   Serial.print("us\t\tBatch: ");
+   Serial.print(batch);
+   Serial.println("us");
+}
@@ -0,0 +1,209 @@
+/*
+Environment_Calculations_FastMath.ino
+
+This code sweeps DewPoint, AbsoluteHumidity, Altitude and
+EquivalentSeaLevelPressure over the sensor's operating range
+(-40..85°C, 1..100%RH, 300..1100hPa), compares each against the
+original formula evaluated with libm, and prints the maximum error,
+pass or fail against the documented bound, and the time per call.
+
+Build the library with ENVIRONMENT_CALCULATIONS_FAST_MATH defined to
+make the calculations use the approximations.
+
+GNU General Public License
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+No sensor is needed.
+
+ */
+
+#include <EnvironmentCalculations.h>
+
+#define SERIAL_BAUD 115200
+
+// Documented maximum errors, see EnvironmentCalculations.h.
+const float DEW_POINT_BOUND = 0.001;          // °C
+const float ABSOLUTE_HUMIDITY_BOUND = 0.001;  // %
+const float ALTITUDE_BOUND = 0.5;             // m
+const float SEA_LEVEL_PRESSURE_BOUND = 0.01;  // %
+
+//////////////////////////////////////////////////////////////////
+void setup()
+{
+  Serial.begin(SERIAL_BAUD);
+
+  while(!Serial) {} // Wait
+}
+
+//////////////////////////////////////////////////////////////////
+void loop()
+{
+#ifndef ENVIRONMENT_CALCULATIONS_FAST_MATH
+   Serial.println("ENVIRONMENT_CALCULATIONS_FAST_MATH is not defined for this sketch.");
+#endif
+
+   sweepDewPoint();
+   sweepAbsoluteHumidity();
+   sweepAltitude();
+   sweepSeaLevelPressure();
+
+   Serial.println("***************************************");
+   delay(10000);
+}
+
+//////////////////////////////////////////////////////////////////
+// -40..85 °C in 1 °C steps, 1..100 %RH in 3 %RH steps.
+void sweepDewPoint()
+{
+   float maxError = 0;
+   uint32_t fast = 0, libm = 0, count = 0;
+
+   for(int temp = -40; temp <= 85; ++temp)
+   {
+      for(int hum = 1; hum <= 100; hum += 3)
+      {
+         uint32_t start = micros();
+         float approx = EnvironmentCalculations::DewPoint(temp, hum);
+         fast += micros() - start;
+
+         start = micros();
+         double gamma = log(hum / 100.0) + (17.625 * temp) / (243.04 + temp);
+         float exact = 243.04 * gamma / (17.625 - gamma);
+         libm += micros() - start;
+
+         float error = fabs(approx - exact);
+         if(error > maxError) { maxError = error; }
+         ++count;
+      }
+   }
+
+   printResult("DewPoint", maxError, "C", DEW_POINT_BOUND, fast, libm, count);
+}
+
+//////////////////////////////////////////////////////////////////
+// -40..85 °C in 1 °C steps, 1..100 %RH in 3 %RH steps.
+void sweepAbsoluteHumidity()
+{
+   float maxError = 0;
+   uint32_t fast = 0, libm = 0, count = 0;
+
+   for(int temp = -40; temp <= 85; ++temp)
+   {
+      for(int hum = 1; hum <= 100; hum += 3)
+      {
+         uint32_t start = micros();
+         float approx = EnvironmentCalculations::AbsoluteHumidity(temp, hum,
+            EnvironmentCalculations::TempUnit_Celsius);
+         fast += micros() - start;
+
+         start = micros();
+         float exact = 6.112 * exp((17.67 * temp) / (temp + 243.5)) * hum * 18.01534
+            / ((273.15 + temp) * 8.31447215);
+         libm += micros() - start;
+
+         float error = fabs(approx / exact - 1) * 100;
+         if(error > maxError) { maxError = error; }
+         ++count;
+      }
+   }
+
+   printResult("AbsoluteHumidity", maxError, "%", ABSOLUTE_HUMIDITY_BOUND, fast, libm, count);
+}
+
+//////////////////////////////////////////////////////////////////
+// 300..1100 hPa in 5 hPa steps, -40..85 °C in 5 °C steps.
+void sweepAltitude()
+{
+   float maxError = 0;
+   uint32_t fast = 0, libm = 0, count = 0;
+
+   for(long pressure = 30000; pressure <= 110000; pressure += 500)
+   {
+      for(int temp = -40; temp <= 85; temp += 5)
+      {
+         uint32_t start = micros();
+         float approx = EnvironmentCalculations::Altitude(pressure,
+            EnvironmentCalculations::AltitudeUnit_Meters, 101325, temp);
+         fast += micros() - start;
+
+         start = micros();
+         float exact = (pow(101325.0 / pressure, 0.190234) - 1) * ((temp + 273.15) / 0.0065);
+         libm += micros() - start;
+
+         float error = fabs(approx - exact);
+         if(error > maxError) { maxError = error; }
+         ++count;
+      }
+   }
+
+   printResult("Altitude", maxError, "m", ALTITUDE_BOUND, fast, libm, count);
+}
+
+//////////////////////////////////////////////////////////////////
+// 0..9000 m in 100 m steps, which covers 300..1100 hPa, and
+// -40..85 °C in 5 °C steps. The relative error does not depend
+// on the station pressure.
+void sweepSeaLevelPressure()
+{
+   float maxError = 0;
+   uint32_t fast = 0, libm = 0, count = 0;
+   const float pressure = 100000;
+
+   for(int altitude = 0; altitude <= 9000; altitude += 100)
+   {
+      for(int temp = -40; temp <= 85; temp += 5)
+      {
+         uint32_t start = micros();
+         float approx = EnvironmentCalculations::EquivalentSeaLevelPressure(altitude, temp, pressure);
+         fast += micros() - start;
+
+         start = micros();
+         float exact = pressure / pow(1 - ((0.0065 * altitude) / (temp + (0.0065 * altitude) + 273.15)), 5.257);
+         libm += micros() - start;
+
+         float error = fabs(approx / exact - 1) * 100;
+         if(error > maxError) { maxError = error; }
+         ++count;
+      }
+   }
+
+   printResult("EquivalentSeaLevelPressure", maxError, "%", SEA_LEVEL_PRESSURE_BOUND, fast, libm, count);
+}
+
+//////////////////////////////////////////////////////////////////
+void printResult
+(
+   const char* name,
+   float maxError,
+   const char* unit,
+   float bound,
+   uint32_t fast,
+   uint32_t libm,
+   uint32_t count
+)
+{
+   Serial.print(name);
+   Serial.print(" error: ");
+   Serial.print(maxError, 6);
+   Serial.print(unit);
+   Serial.print(" (bound ");
+   Serial.print(bound, 3);
+   Serial.print(unit);
+   Serial.println(maxError <= bound ? ") PASS" : ") FAIL");
+
+   Serial.print("   Fast: ");
+   printTime(float(fast) / count);
+   Serial.print("   libm: ");
+   printTime(float(libm) / count);
+}
+
+//////////////////////////////////////////////////////////////////
+void printTime(float us)
+{
+   Serial.print(us);
+   Serial.print(" us/call, ");
+   Serial.print(us * (F_CPU / 1000000UL), 0);
+   Serial.println(" cycles/call");
+}
@@ -0,0 +1,373 @@
+/*
+bme280_capi.cpp
+
+C interface to the BME280 compensation and environment calculations
+for host programs. This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This header must be included in any derived code or copies of the code.
+
+ */
+
+#include "bme280_capi.h"
+
+#include "BME280Calibration.h"
+#include "EnvironmentCalculations.h"
+
+#include <new>
+
+using namespace EnvironmentCalculations;
+
+struct bme280_calibration
+{
+   BME280Calibration calibration;
+};
+
+
+/****************************************************************/
+static TempUnit ToTempUnit
+(
+   int unit
+)
+{
+   return unit == BME280_TEMP_FAHRENHEIT ? TempUnit_Fahrenheit : TempUnit_Celsius;
+}
+
+
+/****************************************************************/
+static AltitudeUnit ToAltitudeUnit
+(
+   int unit
+)
+{
+   return unit == BME280_ALTITUDE_FEET ? AltitudeUnit_Feet : AltitudeUnit_Meters;
+}
+
+
+/****************************************************************/
+uint32_t bme280_abi_version(void)
+{
+   return BME280_ABI_VERSION;
+}
+
+
+/****************************************************************/
+bme280_calibration* bme280_calibration_new
+(
+   const uint8_t trim[BME280_TRIM_LENGTH]
+)
+{
+   bme280_calibration* calibration = new (std::nothrow) bme280_calibration;
+   if(calibration != NULL)
+   {
+      calibration->calibration.decode(trim);
+   }
+   return calibration;
+}
+
+
+/****************************************************************/
+void bme280_calibration_free
+(
+   bme280_calibration* calibration
+)
+{
+   delete calibration;
+}
+
+
+/****************************************************************/
+void bme280_decode_data
+(
+   const uint8_t data[BME280_DATA_LENGTH],
+   int32_t* raw_pressure,
+   int32_t* raw_temperature,
+   int32_t* raw_humidity
+)
+{
+   *raw_pressure    = ((int32_t)data[0] << 12) | (data[1] << 4) | (data[2] >> 4);
+   *raw_temperature = ((int32_t)data[3] << 12) | (data[4] << 4) | (data[5] >> 4);
+   *raw_humidity    = (data[6] << 8) | data[7];
+}
+
+
+/****************************************************************/
+int32_t bme280_temperature
+(
+   const bme280_calibration* calibration,
+   int32_t raw,
+   int32_t* t_fine
+)
+{
+   return calibration->calibration.temperature(raw, *t_fine);
+}
+
+
+/****************************************************************/
+uint32_t bme280_pressure
+(
+   const bme280_calibration* calibration,
+   int32_t raw,
+   int32_t t_fine
+)
+{
+   return calibration->calibration.pressure(raw, t_fine);
+}
+
+
+/****************************************************************/
+uint32_t bme280_humidity
+(
+   const bme280_calibration* calibration,
+   int32_t raw,
+   int32_t t_fine
+)
+{
+   return calibration->calibration.humidity(raw, t_fine);
+}
+
+
+/****************************************************************/
+void bme280_compensate
+(
+   const bme280_calibration* calibration,
+   const int32_t raw_pressure[],
+   const int32_t raw_temperature[],
+   const int32_t raw_humidity[],
+   size_t count,
+   int32_t temperature[],
+   uint32_t pressure[],
+   uint32_t humidity[]
+)
+{
+   calibration->calibration.compensate(raw_pressure, raw_temperature, raw_humidity,
+      count, temperature, pressure, humidity);
+}
+
+
+/****************************************************************/
+float bme280_altitude
+(
+   float pressure,
+   int alt_unit,
+   float reference_pressure,
+   float outdoor_temp,
+   int temp_unit
+)
+{
+   return Altitude(pressure, ToAltitudeUnit(alt_unit), reference_pressure,
+      outdoor_temp, ToTempUnit(temp_unit));
+}
+
+
+/****************************************************************/
+float bme280_sea_level_pressure
+(
+   float altitude,
+   float temp,
+   float pressure,
+   int alt_unit,
+   int temp_unit
+)
+{
+   return EquivalentSeaLevelPressure(altitude, temp, pressure,
+      ToAltitudeUnit(alt_unit), ToTempUnit(temp_unit));
+}
+
+
+/****************************************************************/
+float bme280_dew_point
+(
+   float temp,
+   float humidity,
+   int temp_unit
+)
+{
+   return DewPoint(temp, humidity, ToTempUnit(temp_unit));
+}
+
+
+/****************************************************************/
+float bme280_absolute_humidity
+(
+   float temp,
+   float humidity,
+   int temp_unit
+)
+{
+   return AbsoluteHumidity(temp, humidity, ToTempUnit(temp_unit));
+}
+
+
+/****************************************************************/
+float bme280_heat_index
+(
+   float temp,
+   float humidity,
+   int temp_unit
+)
+{
+   return HeatIndex(temp, humidity, ToTempUnit(temp_unit));
+}
+
+
+/****************************************************************/
+void bme280_derived_metrics
+(
+   float temp,
+   float humidity,
+   float pressure,
+   int temp_unit,
+   int alt_unit,
+   float reference_pressure,
+   float outdoor_temp,
+   bme280_metrics* metrics
+)
+{
+   Metrics result = DerivedMetrics(temp, humidity, pressure, ToTempUnit(temp_unit),
+      ToAltitudeUnit(alt_unit), reference_pressure, outdoor_temp);
+
+   metrics->dew_point = result.dewPoint;
+   metrics->absolute_humidity = result.absoluteHumidity;
+   metrics->heat_index = result.heatIndex;
+   metrics->altitude = result.altitude;
+   metrics->saturation_vapor_pressure = result.saturationVaporPressure;
+}
+
+
+/****************************************************************/
+void bme280_altitude_batch
+(
+   const float pressure[],
+   float altitude[],
+   size_t count,
+   int alt_unit,
+   float reference_pressure,
+   float outdoor_temp,
+   int temp_unit
+)
+{
+   Altitude(pressure, altitude, count, ToAltitudeUnit(alt_unit), reference_pressure,
+      outdoor_temp, ToTempUnit(temp_unit));
+}
+
+
+/****************************************************************/
+void bme280_sea_level_pressure_batch
+(
+   float altitude,
+   const float temp[],
+   const float pressure[],
+   float sea_level_pressure[],
+   size_t count,
+   int alt_unit,
+   int temp_unit
+)
+{
+   EquivalentSeaLevelPressure(altitude, temp, pressure, sea_level_pressure, count,
+      ToAltitudeUnit(alt_unit), ToTempUnit(temp_unit));
+}
+
+
+/****************************************************************/
+void bme280_dew_point_batch
+(
+   const float temp[],
+   const float humidity[],
+   float dew_point[],
+   size_t count,
+   int temp_unit
+)
+{
+   DewPoint(temp, humidity, dew_point, count, ToTempUnit(temp_unit));
+}
+
+
+/****************************************************************/
+void bme280_absolute_humidity_batch
+(
+   const float temp[],
+   const float humidity[],
+   float absolute_humidity[],
+   size_t count,
+   int temp_unit
+)
+{
+   AbsoluteHumidity(temp, humidity, absolute_humidity, count, ToTempUnit(temp_unit));
+}
+
+
+/****************************************************************/
+void bme280_heat_index_batch
+(
+   const float temp[],
+   const float humidity[],
+   float heat_index[],
+   size_t count,
+   int temp_unit
+)
+{
+   HeatIndex(temp, humidity, heat_index, count, ToTempUnit(temp_unit));
+}
+
+
+/****************************************************************/
+int32_t bme280_dew_point_fixed
+(
+   int32_t temp,
+   uint32_t humidity
+)
+{
+   return DewPointFixed(temp, humidity);
+}
+
+
+/****************************************************************/
+uint32_t bme280_absolute_humidity_fixed
+(
+   int32_t temp,
+   uint32_t humidity
+)
+{
+   return AbsoluteHumidityFixed(temp, humidity);
+}
+
+
+/****************************************************************/
+int32_t bme280_altitude_fixed
+(
+   uint32_t pressure,
+   uint32_t reference_pressure,
+   int32_t outdoor_temp
+)
+{
+   return AltitudeFixed(pressure, reference_pressure, outdoor_temp);
+}
+
+
+/****************************************************************/
+uint32_t bme280_sea_level_pressure_fixed
+(
+   int32_t altitude,
+   int32_t temp,
+   uint32_t pressure
+)
+{
+   return EquivalentSeaLevelPressureFixed(altitude, temp, pressure);
+}
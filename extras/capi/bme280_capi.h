@@ -0,0 +1,282 @@
+/*
+bme280_capi.h
+
+C interface to the BME280 compensation and environment calculations
+for host programs. This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This code is licensed under the GNU LGPL and is open for ditrbution
+and copying in accordance with the license.
+This header must be included in any derived code or copies of the code.
+
+The functions wrap BME280Calibration and EnvironmentCalculations, the
+same code that runs on the device, so every caller gets identical
+results. Only C types cross the interface: fixed width integers,
+floats, pointers and an opaque calibration handle. Functions are only
+ever added, existing ones keep their signature; bme280_abi_version()
+is raised when functions are added.
+
+Build libbme280.so with make in this directory, see the Makefile,
+which defines BME280_BUILD. From Python, declare the types of every
+function used, ctypes otherwise truncates the handle to an int:
+
+   lib = ctypes.CDLL("./libbme280.so")
+   lib.bme280_calibration_new.restype = ctypes.c_void_p
+   lib.bme280_calibration_new.argtypes = [ctypes.c_char_p]
+   lib.bme280_calibration_free.restype = None
+   lib.bme280_calibration_free.argtypes = [ctypes.c_void_p]
+   lib.bme280_temperature.restype = ctypes.c_int32
+   lib.bme280_temperature.argtypes = [ctypes.c_void_p, ctypes.c_int32,
+      ctypes.POINTER(ctypes.c_int32)]
+   lib.bme280_pressure.restype = ctypes.c_uint32
+   lib.bme280_pressure.argtypes = [ctypes.c_void_p, ctypes.c_int32,
+      ctypes.c_int32]
+
+   cal = lib.bme280_calibration_new(bytes(trim))
+   t_fine = ctypes.c_int32()
+   temp = lib.bme280_temperature(cal, raw_temp, ctypes.byref(t_fine))
+   pres = lib.bme280_pressure(cal, raw_pres, t_fine.value)
+   lib.bme280_calibration_free(cal)
+
+From Go, with cgo and #cgo LDFLAGS: -lbme280, include this header.
+
+ */
+
+#ifndef TG_BME_280_CAPI_H
+#define TG_BME_280_CAPI_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(_WIN32)
+#ifdef BME280_BUILD
+#define BME280_API __declspec(dllexport)
+#else
+#define BME280_API __declspec(dllimport)
+#endif
+#else
+#define BME280_API __attribute__((visibility("default")))
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Version of the interface, raised when functions are added. */
+#define BME280_ABI_VERSION 1
+
+/* Length of the trim block, see bme280_calibration_new(). */
+#define BME280_TRIM_LENGTH 32
+
+/* Length of the data registers 0xF7 to 0xFE. */
+#define BME280_DATA_LENGTH 8
+
+/* Units, same values as EnvironmentCalculations. */
+#define BME280_TEMP_CELSIUS      0
+#define BME280_TEMP_FAHRENHEIT   1
+#define BME280_ALTITUDE_METERS   0
+#define BME280_ALTITUDE_FEET     1
+
+typedef struct bme280_calibration bme280_calibration;
+
+typedef struct bme280_metrics
+{
+   float dew_point;                    /* in the temperature unit */
+   float absolute_humidity;            /* g/m³ */
+   float heat_index;                   /* in the temperature unit */
+   float altitude;                     /* in the altitude unit */
+   float saturation_vapor_pressure;    /* hPa */
+} bme280_metrics;
+
+/* Return BME280_ABI_VERSION of the library. */
+BME280_API uint32_t bme280_abi_version(void);
+
+
+/*****************************************************************/
+/* CALIBRATION                                                   */
+/*****************************************************************/
+
+/* Decode a 32 byte trim block in the order read by the driver,
+   0x88-0x8D, 0x8E-0x9F, 0xA1, 0xE1-0xE7, see BME280::trim(). Return
+   null if out of memory. */
+BME280_API bme280_calibration* bme280_calibration_new(
+   const uint8_t trim[BME280_TRIM_LENGTH]);
+
+/* Free a calibration, null is ignored. */
+BME280_API void bme280_calibration_free(
+   bme280_calibration* calibration);
+
+/* Split the 8 data registers, 0xF7 to 0xFE, into raw values. */
+BME280_API void bme280_decode_data(
+   const uint8_t data[BME280_DATA_LENGTH],
+   int32_t* raw_pressure,
+   int32_t* raw_temperature,
+   int32_t* raw_humidity);
+
+/* Compensate a raw temperature, return 0.01 °C and t_fine for the
+   pressure and humidity. */
+BME280_API int32_t bme280_temperature(
+   const bme280_calibration* calibration,
+   int32_t raw,
+   int32_t* t_fine);
+
+/* Compensate a raw pressure, return Pa * 256, 0 if the calibration
+   is invalid. */
+BME280_API uint32_t bme280_pressure(
+   const bme280_calibration* calibration,
+   int32_t raw,
+   int32_t t_fine);
+
+/* Compensate a raw humidity, return %RH * 1024. */
+BME280_API uint32_t bme280_humidity(
+   const bme280_calibration* calibration,
+   int32_t raw,
+   int32_t t_fine);
+
+/* Compensate count raw samples. Output arrays may be null to skip a
+   quantity. Units as above. */
+BME280_API void bme280_compensate(
+   const bme280_calibration* calibration,
+   const int32_t raw_pressure[],
+   const int32_t raw_temperature[],
+   const int32_t raw_humidity[],
+   size_t count,
+   int32_t temperature[],
+   uint32_t pressure[],
+   uint32_t humidity[]);
+
+
+/*****************************************************************/
+/* ENVIRONMENT CALCULATIONS                                      */
+/*****************************************************************/
+
+/* See EnvironmentCalculations.h for the formulas and units. The
+   pressure unit is the unit of the reference pressure. */
+
+BME280_API float bme280_altitude(
+   float pressure,
+   int alt_unit,
+   float reference_pressure,
+   float outdoor_temp,
+   int temp_unit);
+
+BME280_API float bme280_sea_level_pressure(
+   float altitude,
+   float temp,
+   float pressure,
+   int alt_unit,
+   int temp_unit);
+
+BME280_API float bme280_dew_point(
+   float temp,
+   float humidity,
+   int temp_unit);
+
+BME280_API float bme280_absolute_humidity(
+   float temp,
+   float humidity,
+   int temp_unit);
+
+BME280_API float bme280_heat_index(
+   float temp,
+   float humidity,
+   int temp_unit);
+
+/* A NAN outdoor_temp is 15 °C (ISA) in either temperature unit. */
+BME280_API void bme280_derived_metrics(
+   float temp,
+   float humidity,
+   float pressure,
+   int temp_unit,
+   int alt_unit,
+   float reference_pressure,
+   float outdoor_temp,
+   bme280_metrics* metrics);
+
+/* Batch versions, count samples each. */
+
+BME280_API void bme280_altitude_batch(
+   const float pressure[],
+   float altitude[],
+   size_t count,
+   int alt_unit,
+   float reference_pressure,
+   float outdoor_temp,
+   int temp_unit);
+
+BME280_API void bme280_sea_level_pressure_batch(
+   float altitude,
+   const float temp[],
+   const float pressure[],
+   float sea_level_pressure[],
+   size_t count,
+   int alt_unit,
+   int temp_unit);
+
+BME280_API void bme280_dew_point_batch(
+   const float temp[],
+   const float humidity[],
+   float dew_point[],
+   size_t count,
+   int temp_unit);
+
+BME280_API void bme280_absolute_humidity_batch(
+   const float temp[],
+   const float humidity[],
+   float absolute_humidity[],
+   size_t count,
+   int temp_unit);
+
+BME280_API void bme280_heat_index_batch(
+   const float temp[],
+   const float humidity[],
+   float heat_index[],
+   size_t count,
+   int temp_unit);
+
+/* Integer versions, temperatures in 0.01 °C, humidity in %RH * 1024,
+   altitude in cm. Invalid inputs return the sentinels of
+   EnvironmentCalculations: INT32_MIN from the dew point for a zero
+   humidity and from the altitude for a zero pressure or a temperature
+   not above absolute zero, 0 from the sea level pressure for such a
+   temperature. */
+
+BME280_API int32_t bme280_dew_point_fixed(
+   int32_t temp,
+   uint32_t humidity);
+
+BME280_API uint32_t bme280_absolute_humidity_fixed(
+   int32_t temp,
+   uint32_t humidity);
+
+BME280_API int32_t bme280_altitude_fixed(
+   uint32_t pressure,
+   uint32_t reference_pressure,
+   int32_t outdoor_temp);
+
+BME280_API uint32_t bme280_sea_level_pressure_fixed(
+   int32_t altitude,
+   int32_t temp,
+   uint32_t pressure);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TG_BME_280_CAPI_H */
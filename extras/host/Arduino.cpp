@@ -0,0 +1,80 @@
+/*
+Arduino.cpp
+
+Minimal Arduino core for building the BME280 driver on a Linux host.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+ */
+
+#include "Arduino.h"
+
+#include <time.h>
+
+// Time skipped by delay() on top of the real elapsed time.
+static uint64_t s_skipped = 0;
+
+
+/****************************************************************/
+static uint64_t Now()
+{
+   static struct timespec start = { 0, 0 };
+   struct timespec now;
+
+   clock_gettime(CLOCK_MONOTONIC, &now);
+   if(start.tv_sec == 0 && start.tv_nsec == 0) { start = now; }
+
+   return (uint64_t)(now.tv_sec - start.tv_sec) * 1000000 +
+      (now.tv_nsec - start.tv_nsec) / 1000 + s_skipped;
+}
+
+
+/****************************************************************/
+unsigned long micros()
+{
+   // Wrap at 32 bits like the targets.
+   return (uint32_t)Now();
+}
+
+
+/****************************************************************/
+unsigned long millis()
+{
+   return (uint32_t)(Now() / 1000);
+}
+
+
+/****************************************************************/
+void delay
+(
+   unsigned long ms
+)
+{
+   s_skipped += (uint64_t)ms * 1000;
+}
+
+
+/****************************************************************/
+void delayMicroseconds
+(
+   unsigned int us
+)
+{
+   s_skipped += us;
+}
@@ -0,0 +1,44 @@
+/*
+Arduino.h
+
+Minimal Arduino core for building the BME280 driver on a Linux host,
+e.g. to run BME280Replay sessions. This file is part of the Arduino
+BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+delay() and delayMicroseconds() do not sleep, they advance the clock
+returned by micros() and millis(). Replayed sessions run at full
+speed while the driver still sees the time pass.
+
+ */
+
+#ifndef TG_HOST_ARDUINO_H
+#define TG_HOST_ARDUINO_H
+
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+unsigned long micros();
+unsigned long millis();
+void delay(unsigned long ms);
+void delayMicroseconds(unsigned int us);
+
+#endif // TG_HOST_ARDUINO_H
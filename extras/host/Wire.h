@@ -0,0 +1,7 @@
+/*
+Wire.h
+
+Empty stand-in for the Arduino Wire library on a Linux host, see
+Arduino.h. This file is part of the Arduino BME280 library.
+
+ */
@@ -0,0 +1,195 @@
+/*
+bme280_session_replay.cpp
+
+Host tool that replays a bus session recorded with BME280Recorder.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+The session runs through the unmodified driver: begin(), then integer
+reads until the session ends. The settings are taken from the last
+values written to ctrl_hum, ctrl_meas and config. Every sample is
+printed as CSV with its recorded time, failed reads as an empty row.
+With -b the session is then replayed the given number of times and
+the time per sample is printed. Add -DBME280_PERF_COUNTERS to also
+print the bus counters.
+
+Build on Linux from this directory:
+
+   g++ -O2 -std=c++11 -I. -I../../src bme280_session_replay.cpp Arduino.cpp \
+      ../../src/BME280.cpp ../../src/BME280Calibration.cpp \
+      ../../src/BME280Replay.cpp ../../src/BME280Session.cpp -o bme280_session_replay
+
+Usage:
+
+   bme280_session_replay [-b repeats] <session file>
+
+A session dumped in hex by the BME_280_Record_Session example can be
+converted with: xxd -r -p session.hex session.bin
+
+ */
+
+#include "BME280Replay.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <vector>
+
+static const uint8_t CTRL_HUM_ADDR  = 0xF2;
+static const uint8_t CTRL_MEAS_ADDR = 0xF4;
+static const uint8_t CONFIG_ADDR    = 0xF5;
+
+
+/****************************************************************/
+static BME280::Settings RecordedSettings
+(
+   const std::vector<uint8_t>& session
+)
+{
+   uint8_t ctrlHum = 0, ctrlMeas = 0, config = 0;
+   BME280SessionReader reader(session.data(), session.size());
+   BME280SessionEntry entry;
+
+   while(reader.next(entry))
+   {
+      if(entry.read) { continue; }
+      if(entry.addr == CTRL_HUM_ADDR) { ctrlHum = entry.data[0]; }
+      if(entry.addr == CTRL_MEAS_ADDR) { ctrlMeas = entry.data[0]; }
+      if(entry.addr == CONFIG_ADDR) { config = entry.data[0]; }
+   }
+
+   return BME280::Settings(
+      (BME280::OSR)(ctrlMeas >> 5),
+      (BME280::OSR)(ctrlHum & 0x07),
+      (BME280::OSR)((ctrlMeas >> 2) & 0x07),
+      (BME280::Mode)(ctrlMeas & 0x03),
+      (BME280::StandbyTime)(config >> 5),
+      (BME280::Filter)((config >> 2) & 0x07),
+      (BME280::SpiEnable)(config & 0x01));
+}
+
+
+/****************************************************************/
+// Run the session once, return the number of reads.
+static size_t Replay
+(
+   BME280Replay& bme,
+   bool print
+)
+{
+   size_t samples = 0;
+   uint32_t pressure, humidity;
+   int32_t temperature;
+
+   bme.rewind();
+   if(!bme.begin())
+   {
+      return 0;
+   }
+
+   while(!bme.finished())
+   {
+      ++samples;
+      if(!bme.read(pressure, temperature, humidity))
+      {
+         if(print) { printf("%u,,,\n", bme.timestamp()); }
+      }
+      else if(print)
+      {
+         printf("%u,%d.%02d,%u,%u.%03u\n", bme.timestamp(),
+            temperature / 100, abs(temperature % 100), pressure,
+            humidity >> 10, ((humidity & 0x3FF) * 1000) >> 10);
+      }
+   }
+
+   return samples;
+}
+
+
+/****************************************************************/
+int main
+(
+   int argc,
+   char* argv[]
+)
+{
+   long repeats = 0;
+   int arg = 1;
+   if(argc > 2 && strcmp(argv[1], "-b") == 0)
+   {
+      repeats = atol(argv[2]);
+      arg = 3;
+   }
+   if(argc - arg != 1)
+   {
+      fprintf(stderr, "usage: %s [-b repeats] <session file>\n", argv[0]);
+      return 2;
+   }
+
+   FILE* file = fopen(argv[arg], "rb");
+   if(file == NULL)
+   {
+      perror(argv[arg]);
+      return 1;
+   }
+   std::vector<uint8_t> session;
+   uint8_t chunk[4096];
+   size_t length;
+   while((length = fread(chunk, 1, sizeof(chunk), file)) > 0)
+   {
+      session.insert(session.end(), chunk, chunk + length);
+   }
+   fclose(file);
+
+   BME280Replay bme(session.data(), session.size(), RecordedSettings(session));
+
+   printf("time_us,temperature_C,pressure_Pa,humidity_RH\n");
+   size_t samples = Replay(bme, true);
+   if(samples == 0)
+   {
+      fprintf(stderr, "%s: begin() failed or no samples\n", argv[arg]);
+      return 1;
+   }
+   fprintf(stderr, "%zu samples, %u mismatches\n", samples, bme.mismatches());
+
+#ifdef BME280_PERF_COUNTERS
+   BME280::PerfCounters perf = bme.perfCounters();
+   fprintf(stderr, "writes %u (%u bytes), reads %u (%u bytes), errors %u, timeouts %u\n",
+      perf.writeCount, perf.bytesWritten, perf.readCount, perf.bytesRead,
+      perf.errors, perf.conversionTimeouts);
+#endif
+
+   if(repeats > 0)
+   {
+      struct timespec start, end;
+      clock_gettime(CLOCK_MONOTONIC, &start);
+      for(long i = 0; i < repeats; ++i)
+      {
+         Replay(bme, false);
+      }
+      clock_gettime(CLOCK_MONOTONIC, &end);
+
+      double ns = (end.tv_sec - start.tv_sec) * 1e9 + (end.tv_nsec - start.tv_nsec);
+      fprintf(stderr, "%.1f ns per sample including begin()\n", ns / (repeats * samples));
+   }
+
+   return 0;
+}
@@ -0,0 +1,202 @@
+/*
+bme280_replay.cpp
+
+Host tool that compensates raw BME280 logs written with BME280Log.h.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+The log is memory-mapped and its records are decoded into columns in
+one sequential pass, then the columns are split into chunks that are
+compensated in parallel with BME280Calibration. The output is one raw
+little-endian array per column, readable with e.g. numpy.fromfile:
+
+   <prefix>.time          uint32, ticks of the header time resolution
+   <prefix>.temperature   int32,  0.01 °C
+   <prefix>.pressure      uint32, Pa * 256
+   <prefix>.humidity      uint32, %RH * 1024 (BME280 logs only)
+
+Build on Linux from this directory:
+
+   g++ -O2 -std=c++11 -pthread -I../../src bme280_replay.cpp \
+      ../../src/BME280Calibration.cpp ../../src/BME280Log.cpp -o bme280_replay
+
+Usage:
+
+   bme280_replay [-j threads] <log file> <output prefix>
+
+ */
+
+#include "BME280Calibration.h"
+#include "BME280Log.h"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <string>
+#include <thread>
+#include <vector>
+
+static const uint8_t CHIP_MODEL_BME280 = 0x60;
+
+
+/****************************************************************/
+template<typename T>
+static bool WriteColumn
+(
+   const std::string& path,
+   const std::vector<T>& column
+)
+{
+   FILE* file = fopen(path.c_str(), "wb");
+   if(file == NULL)
+   {
+      perror(path.c_str());
+      return false;
+   }
+   bool success = fwrite(column.data(), sizeof(T), column.size(), file) == column.size();
+   success &= fclose(file) == 0;
+   return success;
+}
+
+
+/****************************************************************/
+int main
+(
+   int argc,
+   char* argv[]
+)
+{
+   unsigned threads = std::thread::hardware_concurrency();
+   int arg = 1;
+   if(argc > 2 && strcmp(argv[1], "-j") == 0)
+   {
+      threads = atoi(argv[2]);
+      arg = 3;
+   }
+   if(argc - arg != 2)
+   {
+      fprintf(stderr, "usage: %s [-j threads] <log file> <output prefix>\n", argv[0]);
+      return 2;
+   }
+   if(threads == 0) { threads = 1; }
+
+   const char* logPath = argv[arg];
+   const std::string prefix = argv[arg + 1];
+
+   int fd = open(logPath, O_RDONLY);
+   struct stat info;
+   if(fd < 0 || fstat(fd, &info) != 0)
+   {
+      perror(logPath);
+      return 1;
+   }
+
+   size_t length = info.st_size;
+   const uint8_t* log = static_cast<const uint8_t*>(
+      length > 0 ? mmap(NULL, length, PROT_READ, MAP_PRIVATE, fd, 0) : MAP_FAILED);
+   if(log == MAP_FAILED)
+   {
+      fprintf(stderr, "%s: cannot map file\n", logPath);
+      return 1;
+   }
+   madvise(const_cast<uint8_t*>(log), length, MADV_SEQUENTIAL);
+
+   BME280LogReader reader;
+   BME280LogHeader header;
+   size_t ord = reader.readHeader(log, length, header);
+   if(ord == 0)
+   {
+      fprintf(stderr, "%s: not a BME280 log\n", logPath);
+      return 1;
+   }
+
+   // Records are variable length, so the boundaries are found in one
+   // sequential pass that also splits the raw values into columns.
+   size_t estimate = (length - ord) / (BME280LogWriter::MAX_RECORD_LENGTH - 4);
+   std::vector<uint32_t> time;
+   std::vector<int32_t> rawPressure, rawTemperature, rawHumidity;
+   time.reserve(estimate);
+   rawPressure.reserve(estimate);
+   rawTemperature.reserve(estimate);
+   rawHumidity.reserve(estimate);
+
+   BME280LogRecord record;
+   size_t consumed;
+   while((consumed = reader.readRecord(&log[ord], length - ord, record)) != 0)
+   {
+      ord += consumed;
+      time.push_back(record.timestamp);
+      rawPressure.push_back(record.rawPressure());
+      rawTemperature.push_back(record.rawTemperature());
+      rawHumidity.push_back(record.rawHumidity());
+   }
+   if(ord != length)
+   {
+      fprintf(stderr, "%s: ignoring %zu trailing bytes\n", logPath, length - ord);
+   }
+
+   munmap(const_cast<uint8_t*>(log), length);
+   close(fd);
+
+   const bool hasHumidity = header.chipModel == CHIP_MODEL_BME280;
+   const size_t count = time.size();
+   const BME280Calibration calibration(header.trim);
+
+   std::vector<int32_t> temperature(count);
+   std::vector<uint32_t> pressure(count);
+   std::vector<uint32_t> humidity(hasHumidity ? count : 0);
+
+   // Compensation is independent per sample, split it into one chunk per thread.
+   std::vector<std::thread> workers;
+   size_t chunk = (count + threads - 1) / threads;
+   for(size_t begin = 0; begin < count; begin += chunk)
+   {
+      size_t size = count - begin < chunk ? count - begin : chunk;
+      workers.push_back(std::thread([&, begin, size]()
+      {
+         calibration.compensate(
+            &rawPressure[begin], &rawTemperature[begin], &rawHumidity[begin], size,
+            &temperature[begin], &pressure[begin],
+            hasHumidity ? &humidity[begin] : NULL);
+      }));
+   }
+   for(size_t i = 0; i < workers.size(); ++i)
+   {
+      workers[i].join();
+   }
+
+   bool success = WriteColumn(prefix + ".time", time);
+   success &= WriteColumn(prefix + ".temperature", temperature);
+   success &= WriteColumn(prefix + ".pressure", pressure);
+   if(hasHumidity)
+   {
+      success &= WriteColumn(prefix + ".humidity", humidity);
+   }
+
+   fprintf(stderr, "%zu samples, time resolution %u us, %zu threads\n",
+      count, header.timeResolution, workers.size());
+
+   return success ? 0 : 1;
+}
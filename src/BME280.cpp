@@ -32,56 +32,184 @@ courtesy of Brian McNoldy at http://andrew.rsmas.miami.edu.
 
 #include "BME280.h"
 
+#ifdef BME280_PERF_COUNTERS
+// Adds the microseconds spent in the enclosing scope to a counter.
+struct PerfTimer
+{
+   PerfTimer(uint32_t& counter): m_counter(counter), m_start(micros()) {}
+   ~PerfTimer() { m_counter += micros() - m_start; }
+
+   uint32_t& m_counter;
+   uint32_t m_start;
+};
+#define BME280_PERF_TIME(counter) PerfTimer perfTimer(m_perf.counter)
+#define BME280_PERF_COUNT(counter, value) m_perf.counter += (value)
+#else
+#define BME280_PERF_TIME(counter)
+#define BME280_PERF_COUNT(counter, value)
+#endif
+
+#ifdef BME280_TRACE
+#ifndef BME280_TRACE_TIMESTAMP
+#define BME280_TRACE_TIMESTAMP() micros()
+#endif
+#define BME280_TRACE_EVENT(event, addr, length) \
+   BME280TraceSink(*this, TraceEvent_##event, BME280_TRACE_TIMESTAMP(), (addr), (length))
+#else
+#define BME280_TRACE_EVENT(event, addr, length)
+#endif
+
 
 /****************************************************************/
 BME280::BME280
 (
    const Settings& settings
 ):m_settings(settings),
-  m_initialized(false)
+  m_humidityTableBuffer(NULL),
+  m_humidityTableRows(0),
+  m_humidityTableColumns(0),
+  m_temperatureMaxAge(0),
+  m_initialized(false),
+  m_initState(InitState_Idle),
+  m_initStart(0),
+  m_sampleTimed(false),
+  m_triggered(false),
+  m_triggerTime(0)
 {
+   ClearCompensationCache();
 }
 
 
 /****************************************************************/
 bool BME280::Initialize()
 {
-   bool success(true);
+   InitializeInterface();
 
-   success &= ReadChipID();
+   return RunInitialization(InitState_ChipId);
+}
 
-   if(success)
+
+/****************************************************************/
+void BME280::InitializeInterface()
+{
+}
+
+
+/****************************************************************/
+bool BME280::RunInitialization
+(
+   InitState state
+)
+{
+   m_initState = state;
+   m_initialized = false;
+   m_triggered = false;
+
+   while(state != InitState_Ready && state != InitState_Failed)
    {
-      success &= ReadTrim();
+      state = initStep();
 
-      if(m_settings.filter != Filter_Off)
+      if(state == InitState_WaitReset || state == InitState_WaitFilter)
       {
-        InitializeFilter();
+         delay(1);
       }
-      
-      WriteSettings();
    }
 
-   m_initialized = success;
-
-   return m_initialized;
+   return state == InitState_Ready;
 }
 
 
 /****************************************************************/
-void BME280::InitializeFilter()
+BME280::InitState BME280::initStep()
 {
-  // Force an unfiltered measurement to populate the filter buffer.
-  // This fixes a bug that causes the first read to always be 28.82 °C 81732.34 hPa.
-  Filter filter = m_settings.filter;
-  m_settings.filter = Filter_Off;
+   uint8_t status;
+
+   switch(m_initState)
+   {
+      case InitState_Reset:
+         BusWrite(RESET_ADDR, RESET_VALUE);
+         m_initStart = micros();
+         m_initState = InitState_WaitReset;
+         break;
+
+      case InitState_WaitReset:
+         // The chip copies its NVM to the trim registers after the reset,
+         // it is not polled before the start-up time has passed.
+         if(micros() - m_initStart < STARTUP_TIME)
+         {
+            break;
+         }
+         if(BusRead(STATUS_ADDR, &status, 1) && !(status & STATUS_IM_UPDATE))
+         {
+            m_initState = InitState_ChipId;
+         }
+         else if(micros() - m_initStart > STARTUP_TIMEOUT)
+         {
+            m_initState = InitState_Failed;
+         }
+         break;
+
+      case InitState_ChipId:
+         m_initState = ReadChipID() ? InitState_Trim : InitState_Failed;
+         break;
+
+      case InitState_Trim:
+         if(!ReadTrim())
+         {
+            m_initState = InitState_Failed;
+         }
+         else
+         {
+            m_initState = m_settings.filter != Filter_Off ?
+               InitState_Filter : InitState_Config;
+         }
+         break;
+
+      case InitState_Filter:
+      {
+         // Force an unfiltered measurement to populate the filter buffer.
+         // This fixes a bug that causes the first read to always be 28.82 °C 81732.34 hPa.
+         Settings settings = m_settings;
+         m_settings.filter = Filter_Off;
+         m_settings.mode = Mode_Forced;
+
+         bool triggered = WriteSettings();
+
+         m_settings = settings;
+         m_initStart = micros();
+         m_initState = triggered ? InitState_WaitFilter : InitState_Failed;
+         break;
+      }
+
+      case InitState_WaitFilter:
+         if(BusRead(STATUS_ADDR, &status, 1) && !(status & STATUS_MEASURING))
+         {
+            m_initState = InitState_Config;
+         }
+         else if(micros() - m_initStart > MaxMeasurementTime())
+         {
+            BME280_PERF_COUNT(conversionTimeouts, 1);
+            m_initState = InitState_Failed;
+         }
+         break;
+
+      case InitState_Config:
+         m_initialized = WriteSettings();
+         m_initState = m_initialized ? InitState_Ready : InitState_Failed;
+         break;
+
+      default:
+         break;
+   }
 
-  WriteSettings();
+   return m_initState;
+}
 
-  float dummy;
-  read(dummy, dummy, dummy);
 
-  m_settings.filter = filter;
+/****************************************************************/
+BME280::InitState BME280::initState() const
+{
+   return m_initState;
 }
 
 
@@ -90,7 +218,7 @@ bool BME280::ReadChipID()
 {
    uint8_t id[1];
 
-   ReadRegister(ID_ADDR, &id[0], 1);
+   BusRead(ID_ADDR, &id[0], 1);
 
    switch(id[0])
    {
@@ -110,15 +238,21 @@ bool BME280::ReadChipID()
 
 
 /****************************************************************/
-void BME280::WriteSettings()
+bool BME280::WriteSettings()
 {
    uint8_t ctrlHum, ctrlMeas, config;
 
    CalculateRegisters(ctrlHum, ctrlMeas, config);
 
-   WriteRegister(CTRL_HUM_ADDR, ctrlHum);
-   WriteRegister(CTRL_MEAS_ADDR, ctrlMeas);
-   WriteRegister(CONFIG_ADDR, config);
+   // ctrl_hum only takes effect after ctrl_meas is written.
+   uint8_t pairs[] =
+   {
+      CTRL_HUM_ADDR, ctrlHum,
+      CTRL_MEAS_ADDR, ctrlMeas,
+      CONFIG_ADDR, config
+   };
+
+   return BusWrite(pairs, 3);
 }
 
 
@@ -154,9 +288,31 @@ bool BME280::begin
 /****************************************************************/
 bool BME280::reset()
 {
-   WriteRegister(RESET_ADDR, RESET_VALUE);
-   delay(2); //max. startup time according to datasheet
-   return(begin());
+   InitializeInterface();
+
+   return RunInitialization(InitState_Reset);
+}
+
+
+/****************************************************************/
+void BME280::beginAsync()
+{
+   InitializeInterface();
+
+   m_initialized = false;
+   m_triggered = false;
+   m_initState = InitState_ChipId;
+}
+
+
+/****************************************************************/
+void BME280::resetAsync()
+{
+   InitializeInterface();
+
+   m_initialized = false;
+   m_triggered = false;
+   m_initState = InitState_Reset;
 }
 
 /****************************************************************/
@@ -183,19 +339,19 @@ bool BME280::ReadTrim()
    bool success = true;
 
    // Temp. Dig
-   success &= ReadRegister(TEMP_DIG_ADDR, &m_dig[ord], TEMP_DIG_LENGTH);
+   success &= BusRead(TEMP_DIG_ADDR, &m_dig[ord], TEMP_DIG_LENGTH);
    ord += TEMP_DIG_LENGTH;
 
    // Pressure Dig
-   success &= ReadRegister(PRESS_DIG_ADDR, &m_dig[ord], PRESS_DIG_LENGTH);
+   success &= BusRead(PRESS_DIG_ADDR, &m_dig[ord], PRESS_DIG_LENGTH);
    ord += PRESS_DIG_LENGTH;
 
    // Humidity Dig 1
-   success &= ReadRegister(HUM_DIG_ADDR1, &m_dig[ord], HUM_DIG_ADDR1_LENGTH);
+   success &= BusRead(HUM_DIG_ADDR1, &m_dig[ord], HUM_DIG_ADDR1_LENGTH);
    ord += HUM_DIG_ADDR1_LENGTH;
 
    // Humidity Dig 2
-   success &= ReadRegister(HUM_DIG_ADDR2, &m_dig[ord], HUM_DIG_ADDR2_LENGTH);
+   success &= BusRead(HUM_DIG_ADDR2, &m_dig[ord], HUM_DIG_ADDR2_LENGTH);
    ord += HUM_DIG_ADDR2_LENGTH;
 
 #ifdef DEBUG_ON
@@ -208,27 +364,264 @@ bool BME280::ReadTrim()
    Serial.println();
 #endif
 
+   m_calibration.decode(m_dig);
+
+   if(m_humidityTableBuffer != NULL)
+   {
+      m_humidityTable.build(m_calibration, m_humidityTableBuffer,
+         m_humidityTableRows, m_humidityTableColumns);
+   }
+
+   ClearCompensationCache();
+
    return success && ord == DIG_LENGTH;
 }
 
 
+/****************************************************************/
+bool BME280::BusWrite
+(
+   uint8_t addr,
+   uint8_t data
+)
+{
+   BME280_TRACE_EVENT(WriteBegin, addr, 1);
+   bool success = WriteRegister(addr, data);
+   BME280_TRACE_EVENT(WriteEnd, addr, success);
+
+   BME280_PERF_COUNT(writeCount, 1);
+   BME280_PERF_COUNT(bytesWritten, 1);
+   BME280_PERF_COUNT(errors, !success);
+
+   return success;
+}
+
+
+/****************************************************************/
+bool BME280::BusWrite
+(
+   const uint8_t pairs[],
+   uint8_t count
+)
+{
+   BME280_TRACE_EVENT(WriteBegin, pairs[0], count);
+   bool success = WriteRegisters(pairs, count);
+   BME280_TRACE_EVENT(WriteEnd, pairs[0], success ? count : 0);
+
+   BME280_PERF_COUNT(writeCount, 1);
+   BME280_PERF_COUNT(bytesWritten, count);
+   BME280_PERF_COUNT(errors, !success);
+
+   return success;
+}
+
+
+/****************************************************************/
+bool BME280::WriteRegisters
+(
+   const uint8_t pairs[],
+   uint8_t count
+)
+{
+   bool success = true;
+
+   for(uint8_t i = 0; i < count; ++i)
+   {
+      success &= WriteRegister(pairs[2 * i], pairs[2 * i + 1]);
+   }
+
+   return success;
+}
+
+
+/****************************************************************/
+bool BME280::BusRead
+(
+   uint8_t addr,
+   uint8_t data[],
+   uint8_t length
+)
+{
+   BME280_TRACE_EVENT(ReadBegin, addr, length);
+   bool success = ReadRegister(addr, data, length);
+   BME280_TRACE_EVENT(ReadEnd, addr, success ? length : 0);
+
+   BME280_PERF_COUNT(readCount, 1);
+   BME280_PERF_COUNT(bytesRead, length);
+   BME280_PERF_COUNT(errors, !success);
+
+   return success;
+}
+
+
+/****************************************************************/
+uint32_t BME280::MaxMeasurementTime()
+{
+   // Oversampling count of each OSR setting, 0 when skipped.
+   static const uint8_t SAMPLES[] = { 0, 1, 2, 4, 8, 16 };
+
+   uint32_t tosr = SAMPLES[m_settings.tempOSR];
+   uint32_t posr = SAMPLES[m_settings.presOSR];
+   uint32_t hosr = SAMPLES[m_settings.humOSR];
+
+   // t_measure,max from the data sheet, appendix B.
+   return 1250 + 2300 * tosr +
+      (posr ? 2300 * posr + 575 : 0) +
+      (hosr ? 2300 * hosr + 575 : 0);
+}
+
+
+/****************************************************************/
+uint32_t BME280::StandbyDuration()
+{
+   // In StandbyTime order, 0b100 is 500 ms in the data sheet.
+   static const uint32_t STANDBY[] =
+      { 500, 62500, 125000, 250000, 500000, 1000000, 10000, 20000 };
+
+   return STANDBY[m_settings.standbyTime];
+}
+
+
+/****************************************************************/
+void BME280::UpdateSampleTime
+(
+   uint32_t triggerTime,
+   uint32_t doneTime,
+   uint32_t readTime
+)
+{
+   uint32_t measure = MaxMeasurementTime();
+   uint32_t previous = m_sampleTime.measuredTime;
+
+   m_sampleTime.readTime = readTime;
+
+   if(m_settings.mode == Mode_Forced)
+   {
+      // The conversion started with the trigger and finished before
+      // the status poll that found it done.
+      uint32_t duration = doneTime - triggerTime;
+      if(duration > measure) { duration = measure; }
+
+      m_sampleTime.measuredTime = triggerTime + duration / 2;
+      m_sampleTime.uncertainty = duration / 2;
+   }
+   else if(m_settings.mode == Mode_Normal)
+   {
+      // The registers hold the last finished measurement. One ends
+      // every measure + standby, so the last one ended on average
+      // half a cycle before the read.
+      uint32_t cycle = measure + StandbyDuration();
+
+      m_sampleTime.measuredTime = readTime - cycle / 2 - measure / 2;
+      m_sampleTime.uncertainty = cycle / 2;
+   }
+   else
+   {
+      // Sleep mode, the data is from the last forced measurement.
+      return;
+   }
+
+   if(m_sampleTimed)
+   {
+      TimingStats& stats = m_timingStats;
+      uint32_t interval = m_sampleTime.measuredTime - previous;
+
+      if(stats.count == 0)
+      {
+         stats.minInterval = interval;
+         stats.maxInterval = interval;
+         stats.meanInterval = interval;
+         stats.jitter = 0;
+      }
+      else
+      {
+         int32_t error = static_cast<int32_t>(interval - stats.meanInterval);
+         uint32_t deviation = error < 0 ? -error : error;
+
+         if(interval < stats.minInterval) { stats.minInterval = interval; }
+         if(interval > stats.maxInterval) { stats.maxInterval = interval; }
+         stats.meanInterval += error / 8;
+         stats.jitter += static_cast<int32_t>(deviation - stats.jitter) / 4;
+      }
+      ++stats.count;
+   }
+   m_sampleTimed = true;
+}
+
+
+/****************************************************************/
+bool BME280::WaitForConversion()
+{
+   BME280_PERF_TIME(conversionTime);
+   BME280_TRACE_EVENT(WaitBegin, STATUS_ADDR, 1);
+
+   uint32_t start = micros();
+   uint32_t timeout = MaxMeasurementTime();
+   uint8_t status;
+
+   while(BusRead(STATUS_ADDR, &status, 1))
+   {
+      if(!(status & STATUS_MEASURING))
+      {
+         BME280_TRACE_EVENT(WaitEnd, STATUS_ADDR, 1);
+         return true;
+      }
+      if(micros() - start > timeout)
+      {
+         BME280_PERF_COUNT(conversionTimeouts, 1);
+         break;
+      }
+      delay(1);
+   }
+
+   BME280_TRACE_EVENT(WaitEnd, STATUS_ADDR, 0);
+   return false;
+}
+
+
 /****************************************************************/
 bool BME280::ReadData
 (
-   int32_t data[SENSOR_DATA_LENGTH]
+   int32_t data[SENSOR_DATA_LENGTH],
+   uint8_t channels
 )
 {
-   bool success;
-   uint8_t buffer[SENSOR_DATA_LENGTH];
+   BME280_PERF_TIME(readDataTime);
+   BME280_PERF_COUNT(samples, 1);
 
-   // For forced mode we need to write the mode to BME280 register before reading
+   bool success;
+   uint8_t buffer[SENSOR_DATA_LENGTH] = { 0 };
+   uint32_t triggerTime = 0;
+   uint32_t doneTime = 0;
+
+   // Registers are in order: pressure 0xF7-0xF9, temperature 0xFA-0xFC,
+   // humidity 0xFD-0xFE. Read from the first to the last one needed.
+   uint8_t first = (channels & CHANNEL_PRESSURE) ? PRESS_ADDR :
+      (channels & CHANNEL_TEMPERATURE) ? TEMP_ADDR : HUM_ADDR;
+   uint8_t last = (channels & CHANNEL_HUMIDITY) ? HUM_ADDR + 1 :
+      (channels & CHANNEL_TEMPERATURE) ? HUM_ADDR - 1 : TEMP_ADDR - 1;
+   uint8_t length = last - first + 1;
+
+   // For forced mode we need to write the mode to BME280 register before reading,
+   // then wait for the conversion or the data registers still hold the last sample.
    if (m_settings.mode == Mode_Forced)
    {
-      WriteSettings();
+      if(!m_triggered && !trigger()) { return false; }
+      m_triggered = false;
+
+      if(!WaitForConversion()) { return false; }
+      triggerTime = m_triggerTime;
+      doneTime = micros();
    }
 
-   // Registers are in order. So we can start at the pressure register and read 8 bytes.
-   success = ReadRegister(PRESS_ADDR, buffer, SENSOR_DATA_LENGTH);
+   BME280_TRACE_EVENT(BurstBegin, first, length);
+   success = BusRead(first, &buffer[first - PRESS_ADDR], length);
+   BME280_TRACE_EVENT(BurstEnd, first, success ? length : 0);
+
+   if(success)
+   {
+      UpdateSampleTime(triggerTime, doneTime, micros());
+   }
 
    for(int i = 0; i < SENSOR_DATA_LENGTH; ++i)
    {
@@ -249,6 +642,96 @@ bool BME280::ReadData
 }
 
 
+/****************************************************************/
+void BME280::ClearCompensationCache()
+{
+   // Raw values are at most 20 bits, -1 never matches.
+   m_cacheRawTemperature = -1;
+   m_cacheRawPressure = -1;
+   m_cacheRawHumidity = -1;
+}
+
+
+/****************************************************************/
+int32_t BME280::CompensateTemperature
+(
+   int32_t raw,
+   int32_t& t_fine
+)
+{
+   BME280_PERF_TIME(temperatureTime);
+
+   m_cacheTFineTime = millis();
+
+   if(raw == m_cacheRawTemperature)
+   {
+      BME280_PERF_COUNT(cacheHits, 1);
+      t_fine = m_cacheTFine;
+      return m_cacheTemperature;
+   }
+
+   BME280_TRACE_EVENT(CompensateBegin, TEMP_ADDR, 3);
+   m_cacheTemperature = m_calibration.temperature(raw, m_cacheTFine);
+   m_cacheRawTemperature = raw;
+   BME280_TRACE_EVENT(CompensateEnd, TEMP_ADDR, 3);
+
+   t_fine = m_cacheTFine;
+   return m_cacheTemperature;
+}
+
+
+/****************************************************************/
+uint32_t BME280::CompensatePressure
+(
+   int32_t raw,
+   int32_t t_fine
+)
+{
+   BME280_PERF_TIME(pressureTime);
+
+   if(raw == m_cacheRawPressure && t_fine == m_cachePressureTFine)
+   {
+      BME280_PERF_COUNT(cacheHits, 1);
+      return m_cachePressure;
+   }
+
+   BME280_TRACE_EVENT(CompensateBegin, PRESS_ADDR, 3);
+   m_cachePressure = m_calibration.pressure(raw, t_fine);
+   m_cacheRawPressure = raw;
+   m_cachePressureTFine = t_fine;
+   BME280_TRACE_EVENT(CompensateEnd, PRESS_ADDR, 3);
+
+   return m_cachePressure;
+}
+
+
+/****************************************************************/
+uint32_t BME280::CompensateHumidity
+(
+   int32_t raw,
+   int32_t t_fine
+)
+{
+   BME280_PERF_TIME(humidityTime);
+
+   if(raw == m_cacheRawHumidity && t_fine == m_cacheHumidityTFine)
+   {
+      BME280_PERF_COUNT(cacheHits, 1);
+      return m_cacheHumidity;
+   }
+
+   BME280_TRACE_EVENT(CompensateBegin, HUM_ADDR, 2);
+   m_cacheHumidity = m_humidityTable.valid() ?
+      m_humidityTable.humidity(raw, t_fine) :
+      m_calibration.humidity(raw, t_fine);
+   m_cacheRawHumidity = raw;
+   m_cacheHumidityTFine = t_fine;
+   BME280_TRACE_EVENT(CompensateEnd, HUM_ADDR, 2);
+
+   return m_cacheHumidity;
+}
+
+
 /****************************************************************/
 float BME280::CalculateTemperature
 (
@@ -257,15 +740,7 @@ float BME280::CalculateTemperature
    TempUnit unit
 )
 {
-   // Code based on calibration algorthim provided by Bosch.
-   int32_t var1, var2, final;
-   uint16_t dig_T1 = (m_dig[1] << 8) | m_dig[0];
-   int16_t   dig_T2 = (m_dig[3] << 8) | m_dig[2];
-   int16_t   dig_T3 = (m_dig[5] << 8) | m_dig[4];
-   var1 = ((((raw >> 3) - ((int32_t)dig_T1 << 1))) * ((int32_t)dig_T2)) >> 11;
-   var2 = (((((raw >> 4) - ((int32_t)dig_T1)) * ((raw >> 4) - ((int32_t)dig_T1))) >> 12) * ((int32_t)dig_T3)) >> 14;
-   t_fine = var1 + var2;
-   final = (t_fine * 5 + 128) >> 8;
+   int32_t final = CompensateTemperature(raw, t_fine);
    return unit == TempUnit_Celsius ? final/100.0 : final/100.0*9.0/5.0 + 32.0;
 }
 
@@ -277,24 +752,7 @@ float BME280::CalculateHumidity
    int32_t t_fine
 )
 {
-   // Code based on calibration algorthim provided by Bosch.
-   int32_t var1;
-   uint8_t   dig_H1 =   m_dig[24];
-   int16_t dig_H2 = (m_dig[26] << 8) | m_dig[25];
-   uint8_t   dig_H3 =   m_dig[27];
-   int16_t dig_H4 = ((int8_t)m_dig[28] * 16) | (0x0F & m_dig[29]);
-   int16_t dig_H5 = ((int8_t)m_dig[30] * 16) | ((m_dig[29] >> 4) & 0x0F);
-   int8_t   dig_H6 =   m_dig[31];
-
-   var1 = (t_fine - ((int32_t)76800));
-   var1 = (((((raw << 14) - (((int32_t)dig_H4) << 20) - (((int32_t)dig_H5) * var1)) +
-   ((int32_t)16384)) >> 15) * (((((((var1 * ((int32_t)dig_H6)) >> 10) * (((var1 *
-   ((int32_t)dig_H3)) >> 11) + ((int32_t)32768))) >> 10) + ((int32_t)2097152)) *
-   ((int32_t)dig_H2) + 8192) >> 14));
-   var1 = (var1 - (((((var1 >> 15) * (var1 >> 15)) >> 7) * ((int32_t)dig_H1)) >> 4));
-   var1 = (var1 < 0 ? 0 : var1);
-   var1 = (var1 > 419430400 ? 419430400 : var1);
-   return ((uint32_t)(var1 >> 12))/1024.0;
+   return CompensateHumidity(raw, t_fine)/1024.0;
 }
 
 
@@ -306,34 +764,10 @@ float BME280::CalculatePressure
    PresUnit unit
 )
 {
-   // Code based on calibration algorthim provided by Bosch.
-   int64_t var1, var2, pressure;
-   float final;
-
-   uint16_t dig_P1 = (m_dig[7]   << 8) | m_dig[6];
-   int16_t   dig_P2 = (m_dig[9]   << 8) | m_dig[8];
-   int16_t   dig_P3 = (m_dig[11] << 8) | m_dig[10];
-   int16_t   dig_P4 = (m_dig[13] << 8) | m_dig[12];
-   int16_t   dig_P5 = (m_dig[15] << 8) | m_dig[14];
-   int16_t   dig_P6 = (m_dig[17] << 8) | m_dig[16];
-   int16_t   dig_P7 = (m_dig[19] << 8) | m_dig[18];
-   int16_t   dig_P8 = (m_dig[21] << 8) | m_dig[20];
-   int16_t   dig_P9 = (m_dig[23] << 8) | m_dig[22];
-
-   var1 = (int64_t)t_fine - 128000;
-   var2 = var1 * var1 * (int64_t)dig_P6;
-   var2 = var2 + ((var1 * (int64_t)dig_P5) << 17);
-   var2 = var2 + (((int64_t)dig_P4) << 35);
-   var1 = ((var1 * var1 * (int64_t)dig_P3) >> 8) + ((var1 * (int64_t)dig_P2) << 12);
-   var1 = (((((int64_t)1) << 47) + var1)) * ((int64_t)dig_P1) >> 33;
-   if (var1 == 0) { return NAN; }                                                         // Don't divide by zero.
-   pressure   = 1048576 - raw;
-   pressure = (((pressure << 31) - var2) * 3125)/var1;
-   var1 = (((int64_t)dig_P9) * (pressure >> 13) * (pressure >> 13)) >> 25;
-   var2 = (((int64_t)dig_P8) * pressure) >> 19;
-   pressure = ((pressure + var1 + var2) >> 8) + (((int64_t)dig_P7) << 4);
-
-   final = ((uint32_t)pressure)/256.0;
+   uint32_t pressure = CompensatePressure(raw, t_fine);
+   if (pressure == 0) { return NAN; }
+
+   float final = pressure/256.0;
 
    // Conversion units courtesy of www.endmemo.com.
    switch(unit){
@@ -373,7 +807,7 @@ float BME280::temp
 {
    int32_t data[8];
    int32_t t_fine;
-   if(!ReadData(data)){ return NAN; }
+   if(!ReadData(data, CHANNEL_TEMPERATURE)){ return NAN; }
    uint32_t rawTemp   = (data[3] << 12) | (data[4] << 4) | (data[5] >> 4);
    return CalculateTemperature(rawTemp, t_fine, unit);
 }
@@ -387,10 +821,22 @@ float BME280::pres
 {
    int32_t data[8];
    int32_t t_fine;
-   if(!ReadData(data)){ return NAN; }
-   uint32_t rawTemp       = (data[3] << 12) | (data[4] << 4) | (data[5] >> 4);
+
+   // Pressure alone if the cached t_fine is recent enough.
+   if(m_temperatureMaxAge != 0 && m_cacheRawTemperature != -1 &&
+      millis() - m_cacheTFineTime <= m_temperatureMaxAge)
+   {
+      if(!ReadData(data, CHANNEL_PRESSURE)){ return NAN; }
+      t_fine = m_cacheTFine;
+   }
+   else
+   {
+      if(!ReadData(data, CHANNEL_PRESSURE | CHANNEL_TEMPERATURE)){ return NAN; }
+      uint32_t rawTemp = (data[3] << 12) | (data[4] << 4) | (data[5] >> 4);
+      CalculateTemperature(rawTemp, t_fine);
+   }
+
    uint32_t rawPressure = (data[0] << 12) | (data[1] << 4) | (data[2] >> 4);
-   CalculateTemperature(rawTemp, t_fine);
    return CalculatePressure(rawPressure, t_fine, unit);
 }
 
@@ -400,7 +846,7 @@ float BME280::hum()
 {
    int32_t data[8];
    int32_t t_fine;
-   if(!ReadData(data)){ return NAN; }
+   if(!ReadData(data, CHANNEL_TEMPERATURE | CHANNEL_HUMIDITY)){ return NAN; }
    uint32_t rawTemp = (data[3] << 12) | (data[4] << 4) | (data[5] >> 4);
    uint32_t rawHumidity = (data[6] << 8) | data[7];
    CalculateTemperature(rawTemp, t_fine);
@@ -433,6 +879,41 @@ void BME280::read
 }
 
 
+/****************************************************************/
+bool BME280::read
+(
+   uint32_t& pressure,
+   int32_t& temp,
+   uint32_t& humidity
+)
+{
+   int32_t data[8];
+   int32_t t_fine;
+   if(!ReadData(data)){ return false; }
+   uint32_t rawPressure = (data[0] << 12) | (data[1] << 4) | (data[2] >> 4);
+   uint32_t rawTemp = (data[3] << 12) | (data[4] << 4) | (data[5] >> 4);
+   uint32_t rawHumidity = (data[6] << 8) | data[7];
+   temp = CompensateTemperature(rawTemp, t_fine);
+   pressure = (CompensatePressure(rawPressure, t_fine) + 128) >> 8;
+   humidity = CompensateHumidity(rawHumidity, t_fine);
+   return true;
+}
+
+
+/****************************************************************/
+bool BME280::trigger()
+{
+   if(m_settings.mode != Mode_Forced) { return true; }
+
+   BME280_TRACE_EVENT(TriggerBegin, CTRL_HUM_ADDR, 3);
+   m_triggerTime = micros();
+   m_triggered = WriteSettings();
+   BME280_TRACE_EVENT(TriggerEnd, CTRL_HUM_ADDR, m_triggered ? 3 : 0);
+
+   return m_triggered;
+}
+
+
 /****************************************************************/
 BME280::ChipModel BME280::chipModel
 (
@@ -440,3 +921,137 @@ BME280::ChipModel BME280::chipModel
 {
    return m_chip_model;
 }
+
+
+/****************************************************************/
+const uint8_t* BME280::trim
+(
+) const
+{
+   return m_dig;
+}
+
+
+/****************************************************************/
+void BME280::registers
+(
+   uint8_t& ctrlHum,
+   uint8_t& ctrlMeas,
+   uint8_t& config
+)
+{
+   CalculateRegisters(ctrlHum, ctrlMeas, config);
+}
+
+
+/****************************************************************/
+bool BME280::readRaw
+(
+   uint8_t data[SENSOR_DATA_LENGTH]
+)
+{
+   int32_t values[SENSOR_DATA_LENGTH];
+   bool success = ReadData(values);
+   for(int i = 0; i < SENSOR_DATA_LENGTH; ++i)
+   {
+      data[i] = static_cast<uint8_t>(values[i]);
+   }
+   return success;
+}
+
+
+/****************************************************************/
+bool BME280::readRaw
+(
+   int32_t& pressure,
+   int32_t& temperature,
+   int32_t& humidity
+)
+{
+   int32_t data[SENSOR_DATA_LENGTH];
+   if(!ReadData(data)){ return false; }
+
+   pressure    = (data[0] << 12) | (data[1] << 4) | (data[2] >> 4);
+   temperature = (data[3] << 12) | (data[4] << 4) | (data[5] >> 4);
+   humidity    = (data[6] << 8) | data[7];
+
+   return true;
+}
+
+
+
+/****************************************************************/
+bool BME280::setHumidityTable
+(
+   int16_t table[],
+   uint8_t rows,
+   uint8_t columns
+)
+{
+   m_humidityTable.clear();
+   m_humidityTableBuffer = NULL;
+   ClearCompensationCache();
+
+   if(table == NULL) { return true; }
+   if(rows < 2 || columns < 2) { return false; }
+
+   m_humidityTableBuffer = table;
+   m_humidityTableRows = rows;
+   m_humidityTableColumns = columns;
+
+   if(m_initialized)
+   {
+      m_humidityTable.build(m_calibration, table, rows, columns);
+      ClearCompensationCache();
+   }
+
+   return true;
+}
+
+
+/****************************************************************/
+void BME280::setTemperatureMaxAge
+(
+   uint32_t maxAge
+)
+{
+   m_temperatureMaxAge = maxAge;
+}
+
+
+/****************************************************************/
+BME280::SampleTime BME280::sampleTime() const
+{
+   return m_sampleTime;
+}
+
+
+/****************************************************************/
+BME280::TimingStats BME280::timingStats() const
+{
+   return m_timingStats;
+}
+
+
+/****************************************************************/
+void BME280::resetTimingStats()
+{
+   m_timingStats = TimingStats();
+}
+
+#ifdef BME280_PERF_COUNTERS
+/****************************************************************/
+BME280::PerfCounters BME280::perfCounters
+(
+) const
+{
+   return m_perf;
+}
+
+
+/****************************************************************/
+void BME280::resetPerfCounters()
+{
+   m_perf = PerfCounters();
+}
+#endif
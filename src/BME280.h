@@ -33,6 +33,8 @@ This header must be included in any derived code or copies of the code.
 
 #include "Arduino.h"
 
+#include "BME280Calibration.h"
+
 
 //////////////////////////////////////////////////////////////////
 /// BME280 - Driver class for Bosch Bme280 sensor
@@ -117,6 +119,38 @@ public:
       ChipModel_BME280 = 0x60
    };
 
+   // Events passed to BME280TraceSink, see BME280_TRACE below.
+   enum TraceEvent
+   {
+      TraceEvent_WriteBegin,
+      TraceEvent_WriteEnd,
+      TraceEvent_ReadBegin,
+      TraceEvent_ReadEnd,
+      TraceEvent_TriggerBegin,
+      TraceEvent_TriggerEnd,
+      TraceEvent_WaitBegin,
+      TraceEvent_WaitEnd,
+      TraceEvent_BurstBegin,
+      TraceEvent_BurstEnd,
+      TraceEvent_CompensateBegin,
+      TraceEvent_CompensateEnd
+   };
+
+   // Steps of a non-blocking initialization, see initStep().
+   enum InitState
+   {
+      InitState_Idle,
+      InitState_Reset,
+      InitState_WaitReset,
+      InitState_ChipId,
+      InitState_Trim,
+      InitState_Filter,
+      InitState_WaitFilter,
+      InitState_Config,
+      InitState_Ready,
+      InitState_Failed
+   };
+
 /*****************************************************************/
 /* STRUCTURES                                                  */
 /*****************************************************************/
@@ -148,6 +182,63 @@ public:
       SpiEnable spiEnable;
    };
 
+   /////////////////////////////////////////////////////////////////
+   /// Timing of a sample, see sampleTime(). Times are micros()
+   /// values, they wrap after about 71 minutes so compare them by
+   /// unsigned subtraction.
+   struct SampleTime
+   {
+      SampleTime(): readTime(0), measuredTime(0), uncertainty(0) {}
+
+      uint32_t readTime;      // when the data registers were read
+      uint32_t measuredTime;  // estimated middle of the measurement
+      uint32_t uncertainty;   // measuredTime is within +- this
+   };
+
+   /////////////////////////////////////////////////////////////////
+   /// Intervals between the measuredTime of successive samples in
+   /// microseconds, see timingStats(). meanInterval and jitter are
+   /// running averages with weights 1/8 and 1/4, as in a TCP round
+   /// trip time estimator.
+   struct TimingStats
+   {
+      TimingStats(): count(0), minInterval(0), maxInterval(0),
+         meanInterval(0), jitter(0) {}
+
+      uint32_t count;         // intervals measured
+      uint32_t minInterval;
+      uint32_t maxInterval;
+      uint32_t meanInterval;
+      uint32_t jitter;        // mean deviation from meanInterval
+   };
+
+#ifdef BME280_PERF_COUNTERS
+   /////////////////////////////////////////////////////////////////
+   /// Bus traffic and time spent per instance, see perfCounters().
+   /// Times are accumulated microseconds.
+   struct PerfCounters
+   {
+      PerfCounters(): writeCount(0), readCount(0), bytesWritten(0),
+         bytesRead(0), errors(0), conversionTimeouts(0), samples(0),
+         cacheHits(0), readDataTime(0), conversionTime(0),
+         temperatureTime(0), pressureTime(0), humidityTime(0) {}
+
+      uint32_t writeCount;          // register write transactions
+      uint32_t readCount;           // register read transactions
+      uint32_t bytesWritten;
+      uint32_t bytesRead;
+      uint32_t errors;              // failed transactions
+      uint32_t conversionTimeouts;  // forced conversions that did not finish
+      uint32_t samples;             // calls to ReadData
+      uint32_t cacheHits;           // compensations skipped for unchanged raw values
+      uint32_t readDataTime;        // in ReadData, including the conversion
+      uint32_t conversionTime;      // waiting for forced conversions
+      uint32_t temperatureTime;     // compensating temperature
+      uint32_t pressureTime;        // compensating pressure
+      uint32_t humidityTime;        // compensating humidity
+   };
+#endif
+
 /*****************************************************************/
 /* INIT FUNCTIONS                                                */
 /*****************************************************************/
@@ -163,9 +254,30 @@ public:
    bool begin();
 
    ////////////////////////////////////////////////////////////////
-   /// Method to restart BME280. begin() needs to beed called afterwards
+   /// Method to restart BME280 with a soft reset and initialize it
+   /// again as begin() does.
    bool reset();
 
+   ////////////////////////////////////////////////////////////////
+   /// Start begin() or reset() without blocking. The initialization
+   /// is then done by calling initStep() until it returns
+   /// InitState_Ready or InitState_Failed.
+   void beginAsync();
+
+   void resetAsync();
+
+   ////////////////////////////////////////////////////////////////
+   /// Do the next initialization step, at most a few register
+   /// accesses, and return the resulting state. Waits for the reset
+   /// and the filter priming measurement are done by polling the
+   /// status register once per call, after the reset only once the
+   /// start-up time has passed.
+   InitState initStep();
+
+   ////////////////////////////////////////////////////////////////
+   /// Return the initialization state.
+   InitState initState() const;
+
 /*****************************************************************/
 /* ENVIRONMENTAL FUNCTIONS                                       */
 /*****************************************************************/
@@ -195,6 +307,23 @@ public:
       TempUnit  tempUnit    = TempUnit_Celsius,
       PresUnit  presUnit    = PresUnit_hPa);
 
+   /////////////////////////////////////////////////////////////////
+   /// Read the data from the BME280 as the integer results of the
+   /// Bosch compensation, without any floating point: pressure in
+   /// Pa, temperature in 0.01 °C and humidity in %RH * 1024.
+   /// Return true if successful.
+   bool   read(
+      uint32_t& pressure,
+      int32_t&  temperature,
+      uint32_t& humidity);
+
+   /////////////////////////////////////////////////////////////////
+   /// In forced mode, start a measurement without waiting for it.
+   /// The next read waits for this measurement instead of starting
+   /// another, so several sensors can convert at the same time. Does
+   /// nothing in the other modes. Return false on a bus error.
+   bool   trigger();
+
 
 /*****************************************************************/
 /* ACCESSOR FUNCTIONS                                            */
@@ -204,6 +333,82 @@ public:
    /// Method used to return ChipModel.
    ChipModel chipModel();
 
+   ////////////////////////////////////////////////////////////////
+   /// Method used to return the 32 byte trim block read by begin().
+   const uint8_t* trim() const;
+
+   ////////////////////////////////////////////////////////////////
+   /// Method used to return the ctrl_hum, ctrl_meas and config
+   /// register values for the current settings.
+   void registers(
+      uint8_t& ctrlHum,
+      uint8_t& ctrlMeas,
+      uint8_t& config);
+
+   /////////////////////////////////////////////////////////////////
+   /// Read the raw, uncompensated data registers 0xF7 to 0xFE into
+   /// data and return true if successful.
+   bool readRaw(
+      uint8_t data[8]);
+
+   /////////////////////////////////////////////////////////////////
+   /// Read the raw, uncompensated 20 bit pressure and temperature
+   /// and 16 bit humidity and return true if successful.
+   bool readRaw(
+      int32_t& pressure,
+      int32_t& temperature,
+      int32_t& humidity);
+
+   /////////////////////////////////////////////////////////////////
+   /// Compensate humidity by interpolating in a table of up to rows x
+   /// columns entries built from the calibration, see
+   /// BME280HumidityTable. The table is built by begin(), or now if
+   /// begin() already succeeded. Pass null to go back to the formula.
+   /// Return false if the table is too small.
+   bool setHumidityTable(
+      int16_t table[],
+      uint8_t rows,
+      uint8_t columns);
+
+   /////////////////////////////////////////////////////////////////
+   /// Let pres() read only the pressure registers and reuse the
+   /// t_fine of the last temperature read, if that is at most maxAge
+   /// milliseconds old. Any other read refreshes it. 0, the default,
+   /// always reads the temperature with the pressure.
+   void setTemperatureMaxAge(
+      uint32_t maxAge);
+
+   /////////////////////////////////////////////////////////////////
+   /// Return the timing of the last successful read. In forced mode
+   /// the measurement is timed by the trigger and the status polls.
+   /// In normal mode it is estimated from the oversampling and
+   /// standby time: the data is on average half a cycle old. In
+   /// sleep mode the previous measurement is returned again.
+   SampleTime sampleTime() const;
+
+   /////////////////////////////////////////////////////////////////
+   /// Return the interval statistics since construction or the last
+   /// resetTimingStats().
+   TimingStats timingStats() const;
+
+   void resetTimingStats();
+
+#ifdef BME280_PERF_COUNTERS
+/*****************************************************************/
+/* PERFORMANCE COUNTERS                                          */
+/*****************************************************************/
+
+   ////////////////////////////////////////////////////////////////
+   /// Return a snapshot of the counters since construction or the
+   /// last resetPerfCounters(). Only available when the library is built
+   /// with BME280_PERF_COUNTERS defined.
+   PerfCounters perfCounters() const;
+
+   ////////////////////////////////////////////////////////////////
+   /// Set all counters to zero.
+   void resetPerfCounters();
+#endif
+
 protected:
 
 /*****************************************************************/
@@ -216,9 +421,18 @@ protected:
    virtual bool Initialize();
 
    ///////////////////////////////////////////////////////////////
-   /// Force a unfiltered measurement to populate the filter 
-   /// buffer.
-   void InitializeFilter();
+   /// Set up the interface, e.g. the SPI pins, before the first
+   /// register access of begin(), reset() and their Async versions.
+   virtual void InitializeInterface();
+
+   ///////////////////////////////////////////////////////////////
+   /// Write count registers, given as address and data pairs, and
+   /// return true if successful. Transports that can write several
+   /// registers in one transaction override this, the default calls
+   /// WriteRegister for each pair.
+   virtual bool WriteRegisters(
+      const uint8_t pairs[],
+      uint8_t count);
 
 
 /*****************************************************************/
@@ -250,9 +464,15 @@ private:
    static const uint8_t HUM_DIG_ADDR1   = 0xA1;
    static const uint8_t HUM_DIG_ADDR2   = 0xE1;
    static const uint8_t ID_ADDR         = 0xD0;
+   static const uint8_t STATUS_ADDR     = 0xF3;
    static const uint8_t RESET_ADDR	= 0xE0;
 
    static const uint8_t RESET_VALUE	= 0xB6;
+   static const uint8_t STATUS_MEASURING = 0x08;
+   static const uint8_t STATUS_IM_UPDATE = 0x01;
+
+   static const uint32_t STARTUP_TIME    = 2000;  // us, max. start-up time in the data sheet
+   static const uint32_t STARTUP_TIMEOUT = 10000; // us
 
    static const uint8_t TEMP_DIG_LENGTH         = 6;
    static const uint8_t PRESS_DIG_LENGTH        = 18;
@@ -261,6 +481,11 @@ private:
    static const uint8_t DIG_LENGTH              = 32;
    static const uint8_t SENSOR_DATA_LENGTH      = 8;
 
+   static const uint8_t CHANNEL_PRESSURE        = 0x01;
+   static const uint8_t CHANNEL_TEMPERATURE     = 0x02;
+   static const uint8_t CHANNEL_HUMIDITY        = 0x04;
+   static const uint8_t CHANNEL_ALL             = 0x07;
+
 
 /*****************************************************************/
 /* VARIABLES                                                     */
@@ -268,9 +493,40 @@ private:
    Settings m_settings;
 
    uint8_t m_dig[32];
+   BME280Calibration m_calibration;
+   BME280HumidityTable m_humidityTable;
+   int16_t* m_humidityTableBuffer;
+   uint8_t m_humidityTableRows;
+   uint8_t m_humidityTableColumns;
+
+   // Last raw values and their compensated results, see Compensate*.
+   int32_t m_cacheRawTemperature;
+   int32_t m_cacheTFine;
+   int32_t m_cacheTemperature;
+   int32_t m_cacheRawPressure;
+   int32_t m_cachePressureTFine;
+   uint32_t m_cachePressure;
+   int32_t m_cacheRawHumidity;
+   int32_t m_cacheHumidityTFine;
+   uint32_t m_cacheHumidity;
+   uint32_t m_cacheTFineTime;
+   uint32_t m_temperatureMaxAge;
    ChipModel m_chip_model;
 
    bool m_initialized;
+   InitState m_initState;
+   uint32_t m_initStart;
+
+   SampleTime m_sampleTime;
+   TimingStats m_timingStats;
+   bool m_sampleTimed;
+
+   bool m_triggered;
+   uint32_t m_triggerTime;
+
+#ifdef BME280_PERF_COUNTERS
+   PerfCounters m_perf;
+#endif
 
 
 /*****************************************************************/
@@ -295,6 +551,26 @@ private:
 /* WORKER FUNCTIONS                                              */
 /*****************************************************************/
 
+   /////////////////////////////////////////////////////////////////
+   /// Write a register through WriteRegister. All register access
+   /// goes through BusWrite and BusRead so it can be counted.
+   bool BusWrite(
+      uint8_t addr,
+      uint8_t data);
+
+   /////////////////////////////////////////////////////////////////
+   /// Write registers through WriteRegisters.
+   bool BusWrite(
+      const uint8_t pairs[],
+      uint8_t count);
+
+   /////////////////////////////////////////////////////////////////
+   /// Read registers through ReadRegister.
+   bool BusRead(
+      uint8_t addr,
+      uint8_t data[],
+      uint8_t length);
+
    /////////////////////////////////////////////////////////////////
    /// Calculates registers based on settings.
    void CalculateRegisters(
@@ -303,8 +579,8 @@ private:
       uint8_t& config);
 
    /////////////////////////////////////////////////////////////////
-   /// Write the settings to the chip.
-   void WriteSettings();
+   /// Write the settings to the chip, return true if successful.
+   bool WriteSettings();
 
 
    /////////////////////////////////////////////////////////////////
@@ -319,10 +595,63 @@ private:
    bool ReadTrim();
 
    /////////////////////////////////////////////////////////////////
-   /// Read the raw data from the BME280 into an array and return
-   /// true if successful.
+   /// Read the raw data of the CHANNEL_* in channels from the BME280
+   /// into an array laid out like registers 0xF7 to 0xFE and return
+   /// true if successful. Only the smallest register window covering
+   /// the channels is read, the other entries are zero.
    bool ReadData(
-      int32_t data[8]);
+      int32_t data[8],
+      uint8_t channels = CHANNEL_ALL);
+
+   /////////////////////////////////////////////////////////////////
+   /// Return the maximum measurement time in microseconds for the
+   /// current oversampling settings, from the data sheet.
+   uint32_t MaxMeasurementTime();
+
+   /////////////////////////////////////////////////////////////////
+   /// Return the standby time in microseconds for the current
+   /// settings.
+   uint32_t StandbyDuration();
+
+   /////////////////////////////////////////////////////////////////
+   /// Update m_sampleTime and m_timingStats after a successful read.
+   /// In forced mode triggerTime and doneTime bound the conversion.
+   void UpdateSampleTime(
+      uint32_t triggerTime,
+      uint32_t doneTime,
+      uint32_t readTime);
+
+   /////////////////////////////////////////////////////////////////
+   /// Wait for a forced conversion to finish, return false if it did
+   /// not finish within MaxMeasurementTime().
+   bool WaitForConversion();
+
+   /////////////////////////////////////////////////////////////////
+   /// Run initStep() from state until the initialization finishes,
+   /// return true if successful.
+   bool RunInitialization(
+      InitState state);
+
+   /////////////////////////////////////////////////////////////////
+   /// Forget the cached compensation results.
+   void ClearCompensationCache();
+
+   /////////////////////////////////////////////////////////////////
+   /// Run the integer compensation through m_calibration. The last
+   /// result of each is cached and returned again while the raw
+   /// value (and t_fine) are unchanged, which is common in normal
+   /// mode with the filter on.
+   int32_t CompensateTemperature(
+      int32_t raw,
+      int32_t& t_fine);
+
+   uint32_t CompensatePressure(
+      int32_t raw,
+      int32_t t_fine);
+
+   uint32_t CompensateHumidity(
+      int32_t raw,
+      int32_t t_fine);
 
 
    /////////////////////////////////////////////////////////////////
@@ -350,4 +679,28 @@ private:
 
 };
 
+
+//////////////////////////////////////////////////////////////////
+/// Trace sink, defined by the application.
+///
+/// When the library is built with BME280_TRACE defined, every
+/// register access and every phase of a sample (trigger, wait,
+/// burst, compensate) calls this function on entry and exit.
+/// Without the define the calls compile to nothing and the sink
+/// does not need to be defined.
+///
+/// timestamp is BME280_TRACE_TIMESTAMP(), micros() unless defined
+/// otherwise, e.g. as a cycle counter.
+/// addr is the register accessed, or for compensation the first
+/// data register of the quantity. length is the number of bytes
+/// requested on Begin events and the number transferred on End
+/// events, 0 if the transaction or phase failed.
+///
+void BME280TraceSink(
+   const BME280& sensor,
+   BME280::TraceEvent event,
+   uint32_t timestamp,
+   uint8_t addr,
+   uint8_t length);
+
 #endif // TG_BME_280_H
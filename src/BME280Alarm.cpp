@@ -0,0 +1,257 @@
+/*
+BME280Alarm.cpp
+This code checks raw BME280 samples against pressure and humidity limits.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This header must be included in any derived code or copies of the code.
+
+ */
+
+#include "BME280Alarm.h"
+
+// Largest raw values, 20 bit temperature and pressure, 16 bit humidity.
+static const int32_t RAW_MAX = 0xFFFFF;
+static const int32_t RAW_HUMIDITY_MAX = 0xFFFF;
+
+// Near the top of the raw range the pressure formula drops below zero
+// and wraps around. Up to here, far below 300 hPa, it is monotonic.
+static const int32_t RAW_PRESSURE_MAX = 0xF0000;
+
+enum
+{
+   LIMIT_PRESSURE_LOW,
+   LIMIT_PRESSURE_HIGH,
+   LIMIT_HUMIDITY_LOW,
+   LIMIT_HUMIDITY_HIGH,
+   LIMIT_COUNT
+};
+
+
+/****************************************************************/
+BME280Alarm::BME280Alarm
+(
+   const BME280Calibration& calibration,
+   int32_t window
+):m_calibration(calibration),
+  m_window(window),
+  m_derived(false),
+  m_rawTemperatureMin(0),
+  m_rawTemperatureMax(0),
+  m_haveTFine(false),
+  m_tFine(0),
+  m_compensations(0),
+  m_searches(0)
+{
+   for(uint8_t i = 0; i < LIMIT_COUNT; ++i)
+   {
+      m_limits[i].enabled = false;
+   }
+}
+
+
+/****************************************************************/
+void BME280Alarm::setPressureLimits
+(
+   uint32_t low,
+   uint32_t high
+)
+{
+   // Below low is not at least low, above high is at least high + 1.
+   m_limits[LIMIT_PRESSURE_LOW].enabled = low != LIMIT_OFF;
+   m_limits[LIMIT_PRESSURE_LOW].value = low;
+   m_limits[LIMIT_PRESSURE_HIGH].enabled = high != LIMIT_OFF;
+   m_limits[LIMIT_PRESSURE_HIGH].value = high + 1;
+   m_derived = false;
+}
+
+
+/****************************************************************/
+void BME280Alarm::setHumidityLimits
+(
+   uint32_t low,
+   uint32_t high
+)
+{
+   m_limits[LIMIT_HUMIDITY_LOW].enabled = low != LIMIT_OFF;
+   m_limits[LIMIT_HUMIDITY_LOW].value = low;
+   m_limits[LIMIT_HUMIDITY_HIGH].enabled = high != LIMIT_OFF;
+   m_limits[LIMIT_HUMIDITY_HIGH].value = high + 1;
+   m_derived = false;
+}
+
+
+/****************************************************************/
+uint8_t BME280Alarm::check
+(
+   int32_t rawPressure,
+   int32_t rawTemperature,
+   int32_t rawHumidity
+)
+{
+   uint8_t alarms = 0;
+
+   if(!m_derived || rawTemperature < m_rawTemperatureMin ||
+      rawTemperature > m_rawTemperatureMax)
+   {
+      Derive(rawTemperature);
+   }
+
+   m_haveTFine = false;
+
+   if(m_limits[LIMIT_PRESSURE_LOW].enabled &&
+      !AtLeast(m_limits[LIMIT_PRESSURE_LOW], true, -rawPressure, rawTemperature))
+   {
+      alarms |= Alarm_PressureLow;
+   }
+   if(m_limits[LIMIT_PRESSURE_HIGH].enabled &&
+      AtLeast(m_limits[LIMIT_PRESSURE_HIGH], true, -rawPressure, rawTemperature))
+   {
+      alarms |= Alarm_PressureHigh;
+   }
+   if(m_limits[LIMIT_HUMIDITY_LOW].enabled &&
+      !AtLeast(m_limits[LIMIT_HUMIDITY_LOW], false, rawHumidity, rawTemperature))
+   {
+      alarms |= Alarm_HumidityLow;
+   }
+   if(m_limits[LIMIT_HUMIDITY_HIGH].enabled &&
+      AtLeast(m_limits[LIMIT_HUMIDITY_HIGH], false, rawHumidity, rawTemperature))
+   {
+      alarms |= Alarm_HumidityHigh;
+   }
+
+   return alarms;
+}
+
+
+/****************************************************************/
+uint32_t BME280Alarm::compensations() const
+{
+   return m_compensations;
+}
+
+
+/****************************************************************/
+uint32_t BME280Alarm::searches() const
+{
+   return m_searches;
+}
+
+
+/****************************************************************/
+uint32_t BME280Alarm::Compensate
+(
+   bool pressure,
+   int32_t key,
+   int32_t t_fine
+) const
+{
+   return pressure ?
+      m_calibration.pressure(-key, t_fine) :
+      m_calibration.humidity(key, t_fine);
+}
+
+
+/****************************************************************/
+int32_t BME280Alarm::Search
+(
+   bool pressure,
+   uint32_t value,
+   int32_t t_fine
+) const
+{
+   int32_t low = pressure ? -RAW_PRESSURE_MAX : 0;
+   int32_t high = (pressure ? 0 : RAW_HUMIDITY_MAX) + 1;
+
+   // The answer is in [low, high], high meaning none.
+   while(low < high)
+   {
+      int32_t middle = low + (high - low) / 2;
+      if(Compensate(pressure, middle, t_fine) >= value)
+      {
+         high = middle;
+      }
+      else
+      {
+         low = middle + 1;
+      }
+   }
+
+   return low;
+}
+
+
+/****************************************************************/
+void BME280Alarm::Derive
+(
+   int32_t rawTemperature
+)
+{
+   int32_t coldest = rawTemperature - m_window;
+   int32_t warmest = rawTemperature + m_window;
+   int32_t t_fineCold, t_fineWarm;
+
+   m_calibration.temperature(coldest < 0 ? 0 : coldest, t_fineCold);
+   m_calibration.temperature(warmest > RAW_MAX ? RAW_MAX : warmest, t_fineWarm);
+
+   for(uint8_t i = 0; i < LIMIT_COUNT; ++i)
+   {
+      Limit& limit = m_limits[i];
+      if(!limit.enabled) { continue; }
+
+      bool pressure = i <= LIMIT_PRESSURE_HIGH;
+      int32_t cold = Search(pressure, limit.value, t_fineCold);
+      int32_t warm = Search(pressure, limit.value, t_fineWarm);
+
+      limit.keyLow = cold < warm ? cold : warm;
+      limit.keyHigh = cold < warm ? warm : cold;
+   }
+
+   m_rawTemperatureMin = coldest;
+   m_rawTemperatureMax = warmest;
+   m_derived = true;
+   ++m_searches;
+}
+
+
+/****************************************************************/
+bool BME280Alarm::AtLeast
+(
+   const Limit& limit,
+   bool pressure,
+   int32_t key,
+   int32_t rawTemperature
+)
+{
+   if(!pressure || key >= -RAW_PRESSURE_MAX)
+   {
+      if(key >= limit.keyHigh) { return true; }
+      if(key < limit.keyLow) { return false; }
+   }
+
+   // Between the limits at both ends of the window, compensate.
+   if(!m_haveTFine)
+   {
+      m_calibration.temperature(rawTemperature, m_tFine);
+      m_haveTFine = true;
+      ++m_compensations;
+   }
+
+   return Compensate(pressure, key, m_tFine) >= limit.value;
+}
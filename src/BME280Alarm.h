@@ -0,0 +1,176 @@
+/*
+
+BME280Alarm.h
+
+This code checks raw BME280 samples against pressure and humidity limits.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This code is licensed under the GNU LGPL and is open for ditrbution
+and copying in accordance with the license.
+This header must be included in any derived code or copies of the code.
+
+This file only depends on stdint so it also builds on a host.
+
+ */
+
+#ifndef TG_BME_280_ALARM_H
+#define TG_BME_280_ALARM_H
+
+#include <stdint.h>
+
+#include "BME280Calibration.h"
+
+//////////////////////////////////////////////////////////////////
+/// BME280Alarm - Pressure and humidity limits checked on raw
+/// samples, mostly without compensating them.
+///
+/// Compensated pressure falls and humidity rises with the raw
+/// value, so each limit is a raw value that only depends on the
+/// temperature. For a window of raw temperatures around the last
+/// sample the limits are found once by binary search, at both ends
+/// of the window. A raw value beyond both is decided with an integer
+/// compare; between them, and only there, the sample is compensated.
+/// The limits are searched again when the raw temperature leaves the
+/// window. The result is the same as comparing compensated values,
+/// as long as the compensation is monotonic in temperature over the
+/// window. Raw pressures above 0xF0000, far below the range of the
+/// sensor, are always compensated.
+///
+class BME280Alarm
+{
+public:
+
+   enum Alarm
+   {
+      Alarm_PressureLow  = 0x01,
+      Alarm_PressureHigh = 0x02,
+      Alarm_HumidityLow  = 0x04,
+      Alarm_HumidityHigh = 0x08
+   };
+
+   static const uint32_t LIMIT_OFF = 0xFFFFFFFF;
+
+   /////////////////////////////////////////////////////////////////
+   /// Raw temperature window, half width, about 0.5 °C.
+   static const int32_t DEFAULT_WINDOW = 1600;
+
+   /////////////////////////////////////////////////////////////////
+   /// Constructor used to create the class. The calibration must
+   /// outlive the alarm. window is the half width of the raw
+   /// temperature window, larger windows search less often but
+   /// compensate more samples near a limit.
+   BME280Alarm(
+      const BME280Calibration& calibration,
+      int32_t window = DEFAULT_WINDOW);
+
+   /////////////////////////////////////////////////////////////////
+   /// Alarm when the pressure is below low or above high, in
+   /// Pa * 256. LIMIT_OFF turns a limit off.
+   void setPressureLimits(
+      uint32_t low,
+      uint32_t high);
+
+   /////////////////////////////////////////////////////////////////
+   /// Alarm when the humidity is below low or above high, in
+   /// %RH * 1024. LIMIT_OFF turns a limit off.
+   void setHumidityLimits(
+      uint32_t low,
+      uint32_t high);
+
+   /////////////////////////////////////////////////////////////////
+   /// Check a raw sample, see BME280::readRaw(), and return the
+   /// Alarm flags that are set.
+   uint8_t check(
+      int32_t rawPressure,
+      int32_t rawTemperature,
+      int32_t rawHumidity);
+
+   /////////////////////////////////////////////////////////////////
+   /// Return the number of checks that had to compensate.
+   uint32_t compensations() const;
+
+   /////////////////////////////////////////////////////////////////
+   /// Return the number of times the raw limits were searched.
+   uint32_t searches() const;
+
+private:
+
+   /////////////////////////////////////////////////////////////////
+   /// A compensated value and the raw keys where it is crossed. The
+   /// key is the raw value, negated for pressure so both quantities
+   /// rise with it. Over the whole window the compensated value is at
+   /// least value from keyHigh up and below value under keyLow.
+   struct Limit
+   {
+      bool enabled;
+      uint32_t value;
+      int32_t keyLow;
+      int32_t keyHigh;
+   };
+
+   /////////////////////////////////////////////////////////////////
+   /// Compensated pressure or humidity for a key.
+   uint32_t Compensate(
+      bool pressure,
+      int32_t key,
+      int32_t t_fine) const;
+
+   /////////////////////////////////////////////////////////////////
+   /// Return the smallest key with a compensated value of at least
+   /// value, or one past the range.
+   int32_t Search(
+      bool pressure,
+      uint32_t value,
+      int32_t t_fine) const;
+
+   /////////////////////////////////////////////////////////////////
+   /// Search the keys of every limit for the window around
+   /// rawTemperature.
+   void Derive(
+      int32_t rawTemperature);
+
+   /////////////////////////////////////////////////////////////////
+   /// Return true if the compensated value for key is at least the
+   /// limit's value, compensating only when key is between keyLow
+   /// and keyHigh.
+   bool AtLeast(
+      const Limit& limit,
+      bool pressure,
+      int32_t key,
+      int32_t rawTemperature);
+
+   const BME280Calibration& m_calibration;
+   int32_t m_window;
+
+   // 0 and 1 are pressure low and high, 2 and 3 humidity.
+   Limit m_limits[4];
+
+   bool m_derived;
+   int32_t m_rawTemperatureMin;
+   int32_t m_rawTemperatureMax;
+
+   bool m_haveTFine;
+   int32_t m_tFine;
+
+   uint32_t m_compensations;
+   uint32_t m_searches;
+};
+
+#endif // TG_BME_280_ALARM_H
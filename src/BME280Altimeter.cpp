@@ -0,0 +1,243 @@
+/*
+BME280Altimeter.cpp
+This code estimates altitude and vertical speed from pressure.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This header must be included in any derived code or copies of the code.
+
+ */
+
+#include "BME280Altimeter.h"
+#include "EnvironmentCalculations.h"
+
+#include <math.h>
+
+// Distance from the base pressure before it is moved, in Pa * 256.
+// The fourth order term left out is below 0.01 mm here.
+static const int32_t REBASE_DISTANCE = 512L * 256;
+
+// 0.190234, the exponent of the barometric formula, in Q2.30. Same as
+// EnvironmentCalculations::AltitudeFixed().
+static const int64_t EXPONENT = 204262202;
+
+static const int64_t ONE = (int64_t)1 << 30;
+
+
+/****************************************************************/
+BME280Altimeter::BME280Altimeter
+(
+   uint32_t period,
+   uint32_t measurementNoise,
+   uint32_t accelerationNoise
+):m_period(period),
+  m_measurementNoise(measurementNoise),
+  m_accelerationNoise(accelerationNoise),
+  m_seaLevelPressure(101325),
+  m_outdoorTemp(1500)
+{
+   UpdateGains();
+   reset();
+}
+
+
+/****************************************************************/
+void BME280Altimeter::setNoise
+(
+   uint32_t measurementNoise,
+   uint32_t accelerationNoise
+)
+{
+   m_measurementNoise = measurementNoise;
+   m_accelerationNoise = accelerationNoise;
+   UpdateGains();
+}
+
+
+/****************************************************************/
+void BME280Altimeter::setPeriod
+(
+   uint32_t period
+)
+{
+   m_period = period;
+   UpdateGains();
+}
+
+
+/****************************************************************/
+bool BME280Altimeter::setReference
+(
+   uint32_t seaLevelPressure,
+   int32_t outdoorTemp
+)
+{
+   // Rebase() needs seaLevelPressure * 256 in 32 bits and a valid
+   // AltitudeFixed() result.
+   if(seaLevelPressure == 0 || seaLevelPressure > MAX_SEA_LEVEL_PRESSURE ||
+      outdoorTemp <= -27315)
+   {
+      return false;
+   }
+
+   m_seaLevelPressure = seaLevelPressure;
+   m_outdoorTemp = outdoorTemp;
+   reset();
+   return true;
+}
+
+
+/****************************************************************/
+void BME280Altimeter::reset()
+{
+   m_based = false;
+   m_started = false;
+   m_time = 0;
+   m_altitude = 0;
+   m_speed = 0;
+}
+
+
+/****************************************************************/
+void BME280Altimeter::UpdateGains()
+{
+   // Steady state Kalman gains of the constant velocity model from
+   // the tracking index, see Kalata, "The Tracking Index", 1984.
+   float period = m_period / 1e6f;
+   float noise = m_measurementNoise > 0 ? m_measurementNoise : 1;
+   float lambda = m_accelerationNoise * period * period / noise;
+   float r = (4 + lambda - sqrtf(8 * lambda + lambda * lambda)) / 4;
+   float alpha = 1 - r * r;
+   float beta = 2 * (2 - alpha) - 4 * sqrtf(1 - alpha);
+
+   m_alpha = (int32_t)(alpha * 65536 + 0.5f);
+   m_betaPerSecond = period > 0 ? (int32_t)(beta / period * 65536 + 0.5f) : 0;
+}
+
+
+/****************************************************************/
+void BME280Altimeter::gains
+(
+   uint32_t& alpha,
+   uint32_t& beta
+) const
+{
+   alpha = m_alpha;
+   beta = (uint32_t)(((uint64_t)m_betaPerSecond * m_period + 500000) / 1000000);
+}
+
+
+/****************************************************************/
+void BME280Altimeter::Rebase
+(
+   uint32_t pressure,
+   bool continuous
+)
+{
+   int32_t altitude = continuous ? Altitude(pressure) :
+      EnvironmentCalculations::AltitudeFixed(pressure, m_seaLevelPressure * 256,
+         m_outdoorTemp) * 160;
+
+   // h = S * ((p0 / p)^e - 1), S = (T + 273.15) / 0.0065. With A = h + S
+   // the n-th derivative is A * e * (e + 1) ... (e + n - 1) / (-p)^n,
+   // each Taylor coefficient is the one before times -(e + n - 1) / (n p).
+   int64_t scale = ((int64_t)(m_outdoorTemp + 27315) * 2000 * 160) / 13;
+   int64_t a = altitude + scale;
+
+   m_linear = -(((EXPONENT * a) / pressure) >> 6);
+   m_quadratic = (((-m_linear) << 24) / (2 * (int64_t)pressure) * (ONE + EXPONENT)) >> 30;
+   m_cubic = -((((m_quadratic << 24) / (3 * (int64_t)pressure)) * (2 * ONE + EXPONENT)) >> 30);
+   m_basePressure = pressure;
+   m_baseAltitude = altitude;
+   m_based = true;
+}
+
+
+/****************************************************************/
+int32_t BME280Altimeter::Altitude
+(
+   uint32_t pressure
+) const
+{
+   int64_t d = (int32_t)(pressure - m_basePressure);
+   int64_t slope = m_quadratic + ((m_cubic * d) >> 24);
+   slope = m_linear + ((slope * d) >> 24);
+   return m_baseAltitude + (int32_t)((slope * d) >> 24);
+}
+
+
+/****************************************************************/
+bool BME280Altimeter::update
+(
+   uint32_t pressure,
+   uint32_t time
+)
+{
+   if(pressure == 0) { return false; }
+   if(m_started && (int32_t)(time - m_time) <= 0) { return false; }
+
+   int32_t distance = (int32_t)(pressure - m_basePressure);
+   if(distance < 0) { distance = -distance; }
+
+   if(!m_based || distance > 4 * REBASE_DISTANCE)
+   {
+      Rebase(pressure, false);
+   }
+   else if(distance > REBASE_DISTANCE)
+   {
+      Rebase(pressure, true);
+   }
+
+   int32_t measured = Altitude(pressure);
+
+   if(!m_started)
+   {
+      m_started = true;
+      m_time = time;
+      m_altitude = measured;
+      m_speed = 0;
+      return true;
+   }
+
+   // Predict with the speed, mm/s * 256 for dt µs in mm * 16.
+   uint32_t dt = time - m_time;
+   m_time = time;
+   m_altitude += (int32_t)(((int64_t)m_speed * dt) / 16000000);
+
+   // Correct both with the residual.
+   int32_t residual = measured - m_altitude;
+   m_altitude += (int32_t)(((int64_t)m_alpha * residual) >> 16);
+   m_speed += (int32_t)(((int64_t)m_betaPerSecond * residual * 16) >> 16);
+
+   return true;
+}
+
+
+/****************************************************************/
+int32_t BME280Altimeter::altitude() const
+{
+   return (m_altitude + 8) >> 4;
+}
+
+
+/****************************************************************/
+int32_t BME280Altimeter::verticalSpeed() const
+{
+   return (m_speed + 128) >> 8;
+}
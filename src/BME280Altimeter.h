@@ -0,0 +1,165 @@
+/*
+
+BME280Altimeter.h
+
+This code estimates altitude and vertical speed from pressure.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This code is licensed under the GNU LGPL and is open for ditrbution
+and copying in accordance with the license.
+This header must be included in any derived code or copies of the code.
+
+The pressure is converted to altitude with a third order expansion of
+the barometric formula around a base pressure, moved when the pressure
+gets 512 Pa away from it. The altitude and vertical speed are then
+tracked with an alpha-beta filter whose gains are the steady state
+Kalman gains of a constant velocity model, computed when the noise or
+the period is set. update() only uses integer arithmetic.
+
+ */
+
+#ifndef TG_BME_280_ALTIMETER_H
+#define TG_BME_280_ALTIMETER_H
+
+#include <stdint.h>
+
+//////////////////////////////////////////////////////////////////
+/// BME280Altimeter - Altitude and vertical speed at the output data
+/// rate of the sensor.
+class BME280Altimeter
+{
+public:
+
+   /////////////////////////////////////////////////////////////////
+   /// Default noise, about a BME280 at pressure x16 and a slowly
+   /// accelerating vehicle.
+   static const uint32_t MEASUREMENT_NOISE = 100;      // mm
+   static const uint32_t ACCELERATION_NOISE = 1000;    // mm/s²
+
+   /////////////////////////////////////////////////////////////////
+   /// Largest sea-level pressure in Pa, its Pa * 256 fits 32 bits.
+   static const uint32_t MAX_SEA_LEVEL_PRESSURE = 0xFFFFFF;
+
+   /////////////////////////////////////////////////////////////////
+   /// Constructor used to create the class.
+   /// @param period between samples in µs.
+   /// @param measurementNoise standard deviation of the altitude of a
+   ///          single sample in mm.
+   /// @param accelerationNoise standard deviation of the vertical
+   ///          acceleration in mm/s².
+   BME280Altimeter(
+      uint32_t period,
+      uint32_t measurementNoise = MEASUREMENT_NOISE,
+      uint32_t accelerationNoise = ACCELERATION_NOISE);
+
+   /////////////////////////////////////////////////////////////////
+   /// Set the noise and recompute the gains, see the constructor.
+   /// Higher measurement noise smooths more, higher acceleration
+   /// noise follows faster changes.
+   void setNoise(
+      uint32_t measurementNoise,
+      uint32_t accelerationNoise);
+
+   /////////////////////////////////////////////////////////////////
+   /// Set the period between samples in µs and recompute the gains,
+   /// e.g. from BME280::timingStats().meanInterval.
+   void setPeriod(
+      uint32_t period);
+
+   /////////////////////////////////////////////////////////////////
+   /// Set the reference of the altitude and restart.
+   /// @param seaLevelPressure in Pa, 1 to MAX_SEA_LEVEL_PRESSURE.
+   /// @param outdoorTemp in 0.01 °C, above absolute zero (-27315).
+   /// @return false, keeping the previous reference, if a parameter
+   ///          is out of range.
+   bool setReference(
+      uint32_t seaLevelPressure = 101325,
+      int32_t outdoorTemp = 1500);
+
+   /////////////////////////////////////////////////////////////////
+   /// Forget the state, the next sample starts at rest.
+   void reset();
+
+   /////////////////////////////////////////////////////////////////
+   /// Add a pressure in Pa * 256, see BME280Calibration::pressure(),
+   /// measured at time in µs, e.g. BME280::sampleTime().measuredTime.
+   /// Return false and drop the sample if time did not move forward
+   /// or pressure is 0, as from a failed read.
+   bool update(
+      uint32_t pressure,
+      uint32_t time);
+
+   /////////////////////////////////////////////////////////////////
+   /// Return the altitude in mm.
+   int32_t altitude() const;
+
+   /////////////////////////////////////////////////////////////////
+   /// Return the vertical speed in mm/s, positive up.
+   int32_t verticalSpeed() const;
+
+   /////////////////////////////////////////////////////////////////
+   /// Return the gains in Q16, alpha for the altitude and beta for
+   /// the speed times the period.
+   void gains(
+      uint32_t& alpha,
+      uint32_t& beta) const;
+
+private:
+
+   /////////////////////////////////////////////////////////////////
+   /// Compute the gains from the noise and period.
+   void UpdateGains();
+
+   /////////////////////////////////////////////////////////////////
+   /// Move the expansion to pressure, keeping baseAltitude when
+   /// continuous is set, else from the barometric formula.
+   void Rebase(
+      uint32_t pressure,
+      bool continuous);
+
+   /////////////////////////////////////////////////////////////////
+   /// Altitude in mm * 16 for a pressure near the base.
+   int32_t Altitude(
+      uint32_t pressure) const;
+
+   uint32_t m_period;
+   uint32_t m_measurementNoise;
+   uint32_t m_accelerationNoise;
+   int32_t m_alpha;           // Q16
+   int32_t m_betaPerSecond;   // beta / period, Q16 per s
+
+   uint32_t m_seaLevelPressure;
+   int32_t m_outdoorTemp;
+
+   // h(base + d) = baseAltitude + linear * d + quadratic * d^2 + cubic * d^3
+   bool m_based;
+   uint32_t m_basePressure;   // Pa * 256
+   int32_t m_baseAltitude;    // mm * 16
+   int64_t m_linear;          // mm * 16 per Pa * 256, Q24
+   int64_t m_quadratic;       // mm * 16 per (Pa * 256)^2, Q48
+   int64_t m_cubic;           // mm * 16 per (Pa * 256)^3, Q72
+
+   bool m_started;
+   uint32_t m_time;
+   int32_t m_altitude;        // mm * 16
+   int32_t m_speed;           // mm/s * 256
+};
+
+#endif // TG_BME_280_ALTIMETER_H
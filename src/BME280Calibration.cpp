@@ -0,0 +1,361 @@
+/*
+BME280Calibration.cpp
+This code compensates raw BME280 data with the sensor's calibration.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This header must be included in any derived code or copies of the code.
+
+Calibration code based on algorithms provided by Bosch.
+ */
+
+#include "BME280Calibration.h"
+
+// t_fine at -40 and 85 °C, the operating range covered by humidity tables.
+static const int32_t TABLE_T_FINE_MIN = -204800;
+static const int32_t TABLE_T_FINE_MAX = 435200;
+
+// Upper humidity limit of the formula in %RH * 1024.
+static const int32_t HUMIDITY_MAX = 102400;
+
+// Table entries are %RH * 1024 >> TABLE_SCALE_SHIFT, saturated to
+// +-256 %RH so the difference of two entries fits in 16 bits.
+static const uint8_t TABLE_SCALE_SHIFT = 4;
+static const int16_t TABLE_ENTRY_MAX = 16383;
+
+// Interpolation weights are 8 bit, so grid steps are at least 256.
+static const uint8_t TABLE_MIN_SHIFT = 8;
+
+
+/****************************************************************/
+BME280Calibration::BME280Calibration
+(
+):m_T1(0), m_T2(0), m_T3(0),
+  m_P1(0), m_P2(0), m_P3(0), m_P4(0), m_P5(0), m_P6(0), m_P7(0), m_P8(0), m_P9(0),
+  m_H1(0), m_H2(0), m_H3(0), m_H4(0), m_H5(0), m_H6(0)
+{
+}
+
+
+/****************************************************************/
+BME280Calibration::BME280Calibration
+(
+   const uint8_t trim[TRIM_LENGTH]
+)
+{
+   decode(trim);
+}
+
+
+/****************************************************************/
+void BME280Calibration::decode
+(
+   const uint8_t dig[TRIM_LENGTH]
+)
+{
+   m_T1 = (dig[1] << 8) | dig[0];
+   m_T2 = (dig[3] << 8) | dig[2];
+   m_T3 = (dig[5] << 8) | dig[4];
+
+   m_P1 = (dig[7]  << 8) | dig[6];
+   m_P2 = (dig[9]  << 8) | dig[8];
+   m_P3 = (dig[11] << 8) | dig[10];
+   m_P4 = (dig[13] << 8) | dig[12];
+   m_P5 = (dig[15] << 8) | dig[14];
+   m_P6 = (dig[17] << 8) | dig[16];
+   m_P7 = (dig[19] << 8) | dig[18];
+   m_P8 = (dig[21] << 8) | dig[20];
+   m_P9 = (dig[23] << 8) | dig[22];
+
+   m_H1 = dig[24];
+   m_H2 = (dig[26] << 8) | dig[25];
+   m_H3 = dig[27];
+   m_H4 = ((int8_t)dig[28] * 16) | (0x0F & dig[29]);
+   m_H5 = ((int8_t)dig[30] * 16) | ((dig[29] >> 4) & 0x0F);
+   m_H6 = dig[31];
+}
+
+
+/****************************************************************/
+int32_t BME280Calibration::temperature
+(
+   int32_t raw,
+   int32_t& t_fine
+) const
+{
+   // Code based on calibration algorthim provided by Bosch.
+   int32_t var1, var2;
+   var1 = ((((raw >> 3) - ((int32_t)m_T1 << 1))) * ((int32_t)m_T2)) >> 11;
+   var2 = (((((raw >> 4) - ((int32_t)m_T1)) * ((raw >> 4) - ((int32_t)m_T1))) >> 12) * ((int32_t)m_T3)) >> 14;
+   t_fine = var1 + var2;
+   return (t_fine * 5 + 128) >> 8;
+}
+
+
+/****************************************************************/
+uint32_t BME280Calibration::pressure
+(
+   int32_t raw,
+   int32_t t_fine
+) const
+{
+   // Code based on calibration algorthim provided by Bosch.
+   int64_t var1, var2, pressure;
+
+   var1 = (int64_t)t_fine - 128000;
+   var2 = var1 * var1 * (int64_t)m_P6;
+   var2 = var2 + ((var1 * (int64_t)m_P5) << 17);
+   var2 = var2 + (((int64_t)m_P4) << 35);
+   var1 = ((var1 * var1 * (int64_t)m_P3) >> 8) + ((var1 * (int64_t)m_P2) << 12);
+   var1 = (((((int64_t)1) << 47) + var1)) * ((int64_t)m_P1) >> 33;
+   if (var1 == 0) { return 0; }                                                         // Don't divide by zero.
+   pressure   = 1048576 - raw;
+   pressure = (((pressure << 31) - var2) * 3125)/var1;
+   var1 = (((int64_t)m_P9) * (pressure >> 13) * (pressure >> 13)) >> 25;
+   var2 = (((int64_t)m_P8) * pressure) >> 19;
+   pressure = ((pressure + var1 + var2) >> 8) + (((int64_t)m_P7) << 4);
+
+   return (uint32_t)pressure;
+}
+
+
+/****************************************************************/
+uint32_t BME280Calibration::humidity
+(
+   int32_t raw,
+   int32_t t_fine
+) const
+{
+   int32_t humidity = HumidityUnclamped(raw, t_fine);
+   humidity = (humidity < 0 ? 0 : humidity);
+   humidity = (humidity > HUMIDITY_MAX ? HUMIDITY_MAX : humidity);
+   return (uint32_t)humidity;
+}
+
+
+/****************************************************************/
+int32_t BME280Calibration::HumidityUnclamped
+(
+   int32_t raw,
+   int32_t t_fine
+) const
+{
+   // Code based on calibration algorthim provided by Bosch.
+   int32_t var1;
+
+   var1 = (t_fine - ((int32_t)76800));
+   var1 = (((((raw << 14) - (((int32_t)m_H4) << 20) - (((int32_t)m_H5) * var1)) +
+   ((int32_t)16384)) >> 15) * (((((((var1 * ((int32_t)m_H6)) >> 10) * (((var1 *
+   ((int32_t)m_H3)) >> 11) + ((int32_t)32768))) >> 10) + ((int32_t)2097152)) *
+   ((int32_t)m_H2) + 8192) >> 14));
+   var1 = (var1 - (((((var1 >> 15) * (var1 >> 15)) >> 7) * ((int32_t)m_H1)) >> 4));
+   // Clamping var1 to 0..419430400 before the shift is the same as
+   // clamping the result to 0..HUMIDITY_MAX after it.
+   return var1 >> 12;
+}
+
+
+/****************************************************************/
+void BME280Calibration::compensate
+(
+   const int32_t rawPressure[],
+   const int32_t rawTemperature[],
+   const int32_t rawHumidity[],
+   size_t count,
+   int32_t temperature[],
+   uint32_t pressure[],
+   uint32_t humidity[]
+) const
+{
+   for(size_t i = 0; i < count; ++i)
+   {
+      int32_t t_fine;
+      int32_t temp = this->temperature(rawTemperature[i], t_fine);
+      if(temperature != NULL) { temperature[i] = temp; }
+      if(pressure != NULL) { pressure[i] = this->pressure(rawPressure[i], t_fine); }
+      if(humidity != NULL) { humidity[i] = this->humidity(rawHumidity[i], t_fine); }
+   }
+}
+
+
+/****************************************************************/
+// Return the smallest grid step, as a shift, that spans range with points.
+static uint8_t GridShift
+(
+   int32_t range,
+   uint8_t points
+)
+{
+   uint8_t shift = TABLE_MIN_SHIFT;
+   while(((int32_t)(points - 1) << shift) < range)
+   {
+      ++shift;
+   }
+   return shift;
+}
+
+
+/****************************************************************/
+// Return the smallest raw humidity giving more than limit at t_fine.
+static int32_t RawAbove
+(
+   const BME280Calibration& calibration,
+   int32_t t_fine,
+   uint32_t limit
+)
+{
+   int32_t low = 0, high = 0xFFFF;
+   while(low < high)
+   {
+      int32_t mid = (low + high) / 2;
+      if(calibration.humidity(mid, t_fine) > limit) { high = mid; }
+      else { low = mid + 1; }
+   }
+   return low;
+}
+
+
+/****************************************************************/
+BME280HumidityTable::BME280HumidityTable()
+{
+   clear();
+}
+
+
+/****************************************************************/
+void BME280HumidityTable::clear()
+{
+   m_calibration = NULL;
+   m_table = NULL;
+   m_columns = m_rows = 0;
+   m_tempShift = m_rawShift = 0;
+   m_rawMin = m_rawMax = 0;
+}
+
+
+/****************************************************************/
+bool BME280HumidityTable::valid() const
+{
+   return m_table != NULL;
+}
+
+
+/****************************************************************/
+bool BME280HumidityTable::build
+(
+   const BME280Calibration& calibration,
+   int16_t table[],
+   uint8_t rows,
+   uint8_t columns
+)
+{
+   clear();
+   if(table == NULL || rows < 2 || columns < 2) { return false; }
+
+   m_tempShift = GridShift(TABLE_T_FINE_MAX - TABLE_T_FINE_MIN, rows);
+   m_rows = ((TABLE_T_FINE_MAX - TABLE_T_FINE_MIN + (1L << m_tempShift) - 1) >> m_tempShift) + 1;
+
+   // Raw values below 0 %RH or above 100 %RH at every covered
+   // temperature are clamped by the formula, only the rest is tabled.
+   m_rawMin = 0xFFFF;
+   m_rawMax = 0;
+   for(uint8_t i = 0; i < m_rows; ++i)
+   {
+      int32_t t_fine = TABLE_T_FINE_MIN + ((int32_t)i << m_tempShift);
+      int32_t low = RawAbove(calibration, t_fine, 0) - 1;
+      int32_t high = RawAbove(calibration, t_fine, HUMIDITY_MAX - 1);
+      if(low < m_rawMin) { m_rawMin = low; }
+      if(high > m_rawMax) { m_rawMax = high; }
+   }
+   if(m_rawMin < 0) { m_rawMin = 0; }
+   if(m_rawMax <= m_rawMin) { m_rawMax = m_rawMin + 1; }
+
+   m_rawShift = GridShift(m_rawMax - m_rawMin, columns);
+   m_columns = ((m_rawMax - m_rawMin + (1L << m_rawShift) - 1) >> m_rawShift) + 1;
+   m_rawMax = m_rawMin + ((int32_t)(m_columns - 1) << m_rawShift);
+
+   for(uint8_t i = 0; i < m_rows; ++i)
+   {
+      int32_t t_fine = TABLE_T_FINE_MIN + ((int32_t)i << m_tempShift);
+      for(uint8_t j = 0; j < m_columns; ++j)
+      {
+         int32_t raw = m_rawMin + ((int32_t)j << m_rawShift);
+         int32_t humidity = calibration.HumidityUnclamped(raw, t_fine);
+         humidity = (humidity + (1 << (TABLE_SCALE_SHIFT - 1))) >> TABLE_SCALE_SHIFT;
+         humidity = humidity < -TABLE_ENTRY_MAX ? -TABLE_ENTRY_MAX : humidity;
+         humidity = humidity > TABLE_ENTRY_MAX ? TABLE_ENTRY_MAX : humidity;
+         table[i * m_columns + j] = humidity;
+      }
+   }
+
+   m_calibration = &calibration;
+   m_table = table;
+
+   return true;
+}
+
+
+/****************************************************************/
+uint32_t BME280HumidityTable::humidity
+(
+   int32_t raw,
+   int32_t t_fine
+) const
+{
+   int32_t t = t_fine - TABLE_T_FINE_MIN;
+   if(t < 0 || t >= ((int32_t)(m_rows - 1) << m_tempShift))
+   {
+      return m_calibration->humidity(raw, t_fine);
+   }
+
+   uint8_t row = t >> m_tempShift;
+   uint8_t tempWeight = (t & ((1L << m_tempShift) - 1)) >> (m_tempShift - TABLE_MIN_SHIFT);
+
+   // Every product is a 16 bit difference times an 8 bit weight, which
+   // compilers for 8 bit targets do with a widening 16 x 8 multiply.
+   const int16_t* entry = &m_table[row * m_columns];
+   int16_t low, high;
+   if(raw <= m_rawMin)
+   {
+      low = entry[0];
+      high = entry[m_columns];
+   }
+   else if(raw >= m_rawMax)
+   {
+      // Clamp to the last column.
+      entry += m_columns - 1;
+      low = entry[0];
+      high = entry[m_columns];
+   }
+   else
+   {
+      int32_t r = raw - m_rawMin;
+      uint8_t rawWeight = (r & ((1L << m_rawShift) - 1)) >> (m_rawShift - TABLE_MIN_SHIFT);
+      entry += r >> m_rawShift;
+      low = entry[0] + (int16_t)(((int32_t)(int16_t)(entry[1] - entry[0]) * rawWeight + 128) >> 8);
+      entry += m_columns;
+      high = entry[0] + (int16_t)(((int32_t)(int16_t)(entry[1] - entry[0]) * rawWeight + 128) >> 8);
+   }
+
+   int32_t humidity = (int32_t)(low + (int16_t)(((int32_t)(int16_t)(high - low) * tempWeight + 128) >> 8))
+      << TABLE_SCALE_SHIFT;
+   humidity = (humidity < 0 ? 0 : humidity);
+   humidity = (humidity > HUMIDITY_MAX ? HUMIDITY_MAX : humidity);
+   return (uint32_t)humidity;
+}
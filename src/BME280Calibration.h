@@ -0,0 +1,188 @@
+/*
+
+BME280Calibration.h
+
+This code compensates raw BME280 data with the sensor's calibration.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This code is licensed under the GNU LGPL and is open for ditrbution
+and copying in accordance with the license.
+This header must be included in any derived code or copies of the code.
+
+Based on the data sheet provided by Bosch for the Bme280 environmental sensor.
+This file only depends on stdint so it also builds on a host.
+
+ */
+
+#ifndef TG_BME_280_CALIBRATION_H
+#define TG_BME_280_CALIBRATION_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+//////////////////////////////////////////////////////////////////
+/// BME280Calibration - Decoded trim values and the Bosch integer
+/// compensation formulas.
+class BME280Calibration
+{
+public:
+
+   static const uint8_t TRIM_LENGTH = 32;
+
+   BME280Calibration();
+
+   /////////////////////////////////////////////////////////////////
+   /// Construct from a 32 byte trim block, see decode().
+   explicit BME280Calibration(
+      const uint8_t trim[TRIM_LENGTH]);
+
+   /////////////////////////////////////////////////////////////////
+   /// Decode the 32 byte trim block in the order read by the
+   /// driver: 0x88-0x8D, 0x8E-0x9F, 0xA1, 0xE1-0xE7.
+   void decode(
+      const uint8_t trim[TRIM_LENGTH]);
+
+   /////////////////////////////////////////////////////////////////
+   /// Compensate a raw temperature, return 0.01 °C and the t_fine
+   /// value used by the pressure and humidity compensation.
+   int32_t temperature(
+      int32_t raw,
+      int32_t& t_fine) const;
+
+   /////////////////////////////////////////////////////////////////
+   /// Compensate a raw pressure, return Pa * 256, 0 if the
+   /// calibration is invalid.
+   uint32_t pressure(
+      int32_t raw,
+      int32_t t_fine) const;
+
+   /////////////////////////////////////////////////////////////////
+   /// Compensate a raw humidity, return %RH * 1024.
+   uint32_t humidity(
+      int32_t raw,
+      int32_t t_fine) const;
+
+   /////////////////////////////////////////////////////////////////
+   /// Compensate count raw samples. Output arrays may be null to
+   /// skip a quantity; the temperature is always computed.
+   /// @param temperature in 0.01 °C.
+   /// @param pressure in Pa * 256.
+   /// @param humidity in %RH * 1024.
+   void compensate(
+      const int32_t rawPressure[],
+      const int32_t rawTemperature[],
+      const int32_t rawHumidity[],
+      size_t count,
+      int32_t temperature[],
+      uint32_t pressure[],
+      uint32_t humidity[]) const;
+
+private:
+
+   friend class BME280HumidityTable;
+
+   /////////////////////////////////////////////////////////////////
+   /// Humidity in %RH * 1024 before clamping to 0 to 100 %RH.
+   int32_t HumidityUnclamped(
+      int32_t raw,
+      int32_t t_fine) const;
+
+   uint16_t m_T1;
+   int16_t  m_T2;
+   int16_t  m_T3;
+
+   uint16_t m_P1;
+   int16_t  m_P2;
+   int16_t  m_P3;
+   int16_t  m_P4;
+   int16_t  m_P5;
+   int16_t  m_P6;
+   int16_t  m_P7;
+   int16_t  m_P8;
+   int16_t  m_P9;
+
+   uint8_t  m_H1;
+   int16_t  m_H2;
+   uint8_t  m_H3;
+   int16_t  m_H4;
+   int16_t  m_H5;
+   int8_t   m_H6;
+};
+
+
+//////////////////////////////////////////////////////////////////
+/// BME280HumidityTable - Humidity compensation by bilinear
+/// interpolation in a per-device table of the Bosch formula, keyed
+/// on t_fine and raw humidity. It replaces the 32 bit multiply
+/// chain with three multiplies of a 16 bit difference by an 8 bit
+/// weight, which 8 bit targets do as widening 16 x 8 multiplies
+/// instead of 32 x 32. On 32 and 64 bit targets the formula is as
+/// fast or faster.
+///
+/// The table holds the formula before it is clamped to 0 to 100 %RH,
+/// which is smooth, and the result is clamped after interpolating.
+/// It covers -40 to 85 °C and the raw range between 0 and 100 %RH at
+/// those temperatures, outside of it the formula is used.
+/// The error shrinks with the table size, see the
+/// BME_280_Humidity_Table example.
+///
+class BME280HumidityTable
+{
+public:
+
+   BME280HumidityTable();
+
+   /////////////////////////////////////////////////////////////////
+   /// Fill table with the humidity for calibration, using at most
+   /// rows x columns entries. The calibration must outlive the
+   /// table. Return false if table is null or smaller than 2 x 2.
+   bool build(
+      const BME280Calibration& calibration,
+      int16_t table[],
+      uint8_t rows,
+      uint8_t columns);
+
+   /////////////////////////////////////////////////////////////////
+   /// Stop using the table.
+   void clear();
+
+   /////////////////////////////////////////////////////////////////
+   /// Return true if a table has been built.
+   bool valid() const;
+
+   /////////////////////////////////////////////////////////////////
+   /// Compensate a raw humidity, return %RH * 1024.
+   uint32_t humidity(
+      int32_t raw,
+      int32_t t_fine) const;
+
+private:
+
+   const BME280Calibration* m_calibration;
+   const int16_t* m_table;
+   uint8_t m_columns;
+   uint8_t m_rows;
+   uint8_t m_tempShift;
+   uint8_t m_rawShift;
+   int32_t m_rawMin;
+   int32_t m_rawMax;
+};
+
+#endif // TG_BME_280_CALIBRATION_H
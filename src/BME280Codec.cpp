@@ -0,0 +1,239 @@
+/*
+BME280Codec.cpp
+This code compresses streams of BME280 samples for low bandwidth links.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This header must be included in any derived code or copies of the code.
+
+ */
+
+#include "BME280Codec.h"
+
+static const uint8_t TAG_KEYFRAME      = 0x80;
+static const uint8_t TAG_PRESENT_SHIFT = 4;
+static const uint8_t TAG_SEQUENCE_MASK = 0x0F;
+static const uint8_t TAG_SEQUENCE_BITS = 4;
+static const uint16_t SEQUENCE_MASK    = 0x0FFF;
+static const uint8_t HEADER_LENGTH     = 2;
+static const uint8_t VALUE_COUNT       = 3;
+
+
+/****************************************************************/
+static uint8_t WriteVarint
+(
+   uint8_t buffer[],
+   int32_t value
+)
+{
+   // Zigzag maps small magnitudes of either sign to small codes.
+   uint32_t code = ((uint32_t)value << 1) ^ (uint32_t)(value >> 31);
+   uint8_t length = 0;
+
+   while(code >= 0x80)
+   {
+      buffer[length++] = (code & 0x7F) | 0x80;
+      code >>= 7;
+   }
+   buffer[length++] = code;
+
+   return length;
+}
+
+
+/****************************************************************/
+static uint8_t ReadVarint
+(
+   const uint8_t buffer[],
+   size_t length,
+   int32_t& value
+)
+{
+   uint32_t code = 0;
+   uint8_t ord = 0;
+   uint8_t shift = 0;
+
+   do
+   {
+      if(ord >= length || shift > 28) { return 0; }
+      code |= (uint32_t)(buffer[ord] & 0x7F) << shift;
+      shift += 7;
+   } while(buffer[ord++] & 0x80);
+
+   value = (int32_t)(code >> 1) ^ -(int32_t)(code & 1);
+   return ord;
+}
+
+
+/****************************************************************/
+BME280Encoder::BME280Encoder
+(
+   uint8_t keyframeInterval
+):m_keyframeInterval(keyframeInterval),
+  m_sequence(0),
+  m_sinceKeyframe(0)
+{
+   if(m_keyframeInterval < 1) { m_keyframeInterval = 1; }
+   reset();
+}
+
+
+/****************************************************************/
+void BME280Encoder::reset()
+{
+   m_sinceKeyframe = m_keyframeInterval;
+}
+
+
+/****************************************************************/
+uint8_t BME280Encoder::encode
+(
+   uint8_t buffer[MAX_FRAME_LENGTH],
+   int32_t pressure,
+   int32_t temperature,
+   int32_t humidity
+)
+{
+   const int32_t sample[VALUE_COUNT] = { pressure, temperature, humidity };
+   int32_t values[VALUE_COUNT];
+   uint8_t tag = m_sequence & TAG_SEQUENCE_MASK;
+
+   if(m_sinceKeyframe >= m_keyframeInterval)
+   {
+      tag |= TAG_KEYFRAME;
+      m_sinceKeyframe = 0;
+      for(uint8_t i = 0; i < VALUE_COUNT; ++i)
+      {
+         values[i] = sample[i];
+         m_delta[i] = 0;
+      }
+   }
+   else
+   {
+      // Wrapping unsigned arithmetic, mirrored by the decoder.
+      for(uint8_t i = 0; i < VALUE_COUNT; ++i)
+      {
+         int32_t delta = (uint32_t)sample[i] - (uint32_t)m_last[i];
+         values[i] = (uint32_t)delta - (uint32_t)m_delta[i];
+         m_delta[i] = delta;
+      }
+   }
+
+   uint8_t length = HEADER_LENGTH;
+   for(uint8_t i = 0; i < VALUE_COUNT; ++i)
+   {
+      m_last[i] = sample[i];
+      if(values[i] != 0)
+      {
+         tag |= 1 << (TAG_PRESENT_SHIFT + VALUE_COUNT - 1 - i);
+         length += WriteVarint(&buffer[length], values[i]);
+      }
+   }
+   buffer[0] = tag;
+   buffer[1] = m_sequence >> TAG_SEQUENCE_BITS;
+
+   m_sequence = (m_sequence + 1) & SEQUENCE_MASK;
+   ++m_sinceKeyframe;
+
+   return length;
+}
+
+
+/****************************************************************/
+BME280Decoder::BME280Decoder()
+{
+   for(uint8_t i = 0; i < VALUE_COUNT; ++i)
+   {
+      m_last[i] = 0;
+      m_delta[i] = 0;
+   }
+   reset();
+}
+
+
+/****************************************************************/
+void BME280Decoder::reset()
+{
+   m_synchronized = false;
+   m_sequence = 0;
+}
+
+
+/****************************************************************/
+size_t BME280Decoder::decode
+(
+   const uint8_t buffer[],
+   size_t length,
+   int32_t& pressure,
+   int32_t& temperature,
+   int32_t& humidity,
+   bool& valid
+)
+{
+   if(length < HEADER_LENGTH) { return 0; }
+
+   const uint8_t tag = buffer[0];
+   int32_t values[VALUE_COUNT];
+   size_t ord = HEADER_LENGTH;
+
+   for(uint8_t i = 0; i < VALUE_COUNT; ++i)
+   {
+      values[i] = 0;
+      if(tag & (1 << (TAG_PRESENT_SHIFT + VALUE_COUNT - 1 - i)))
+      {
+         uint8_t consumed = ReadVarint(&buffer[ord], length - ord, values[i]);
+         if(consumed == 0) { return 0; }
+         ord += consumed;
+      }
+   }
+
+   const uint16_t sequence = (tag & TAG_SEQUENCE_MASK) |
+      ((uint16_t)buffer[1] << TAG_SEQUENCE_BITS);
+
+   if(tag & TAG_KEYFRAME)
+   {
+      m_synchronized = true;
+      for(uint8_t i = 0; i < VALUE_COUNT; ++i)
+      {
+         m_last[i] = values[i];
+         m_delta[i] = 0;
+      }
+   }
+   else if(m_synchronized && sequence == m_sequence)
+   {
+      for(uint8_t i = 0; i < VALUE_COUNT; ++i)
+      {
+         m_delta[i] = (uint32_t)m_delta[i] + (uint32_t)values[i];
+         m_last[i] = (uint32_t)m_last[i] + (uint32_t)m_delta[i];
+      }
+   }
+   else
+   {
+      m_synchronized = false;
+   }
+
+   m_sequence = (sequence + 1) & SEQUENCE_MASK;
+
+   valid = m_synchronized;
+   pressure = m_last[0];
+   temperature = m_last[1];
+   humidity = m_last[2];
+
+   return ord;
+}
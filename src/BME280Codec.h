@@ -0,0 +1,137 @@
+/*
+
+BME280Codec.h
+
+This code compresses streams of BME280 samples for low bandwidth links.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This code is licensed under the GNU LGPL and is open for ditrbution
+and copying in accordance with the license.
+This header must be included in any derived code or copies of the code.
+
+A sample is three integers, either the 20 bit raw pressure and
+temperature and 16 bit raw humidity, or the fixed point values from
+BME280::read(uint32_t&, int32_t&, uint32_t&).
+
+Frame layout:
+
+   Tag (1 byte)
+      bit 7     keyframe
+      bit 6..4  pressure, temperature, humidity value present
+      bit 3..0  sequence number, bits 3..0
+
+   Sequence (1 byte)
+      bit 7..0  sequence number, bits 11..4
+
+   Values, zigzag LEB128 varints, only those present
+      keyframe  the sample itself
+      otherwise the change of the sample delta (delta of delta),
+                absent values are 0
+
+A slowly varying sample takes 2 to 5 bytes. The decoder tracks the
+12 bit sequence number; after a lost frame it discards frames until
+the next keyframe. A loss of a multiple of 4096 frames in a row goes
+unnoticed, a 4 bit number would miss bursts of 16 frames, which are
+common on links like LoRa.
+
+This file only depends on stdint so the same code decodes on the
+target and on a host.
+
+ */
+
+#ifndef TG_BME_280_CODEC_H
+#define TG_BME_280_CODEC_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+//////////////////////////////////////////////////////////////////
+/// BME280Encoder - Encodes samples into caller provided buffers.
+class BME280Encoder
+{
+public:
+
+   static const uint8_t MAX_FRAME_LENGTH = 17;
+
+   /////////////////////////////////////////////////////////////////
+   /// @param keyframeInterval  a keyframe is sent every interval
+   ///          frames, at least 1. Lost frames are recovered at the
+   ///          next keyframe.
+   BME280Encoder(
+      uint8_t keyframeInterval = 16);
+
+   /////////////////////////////////////////////////////////////////
+   /// Encode one sample.
+   /// @return number of bytes written, at most MAX_FRAME_LENGTH.
+   uint8_t encode(
+      uint8_t buffer[MAX_FRAME_LENGTH],
+      int32_t pressure,
+      int32_t temperature,
+      int32_t humidity);
+
+   /////////////////////////////////////////////////////////////////
+   /// Make the next frame a keyframe.
+   void reset();
+
+private:
+
+   uint8_t m_keyframeInterval;
+   uint16_t m_sequence;
+   uint8_t m_sinceKeyframe;
+   int32_t m_last[3];
+   int32_t m_delta[3];
+};
+
+
+//////////////////////////////////////////////////////////////////
+/// BME280Decoder - Decodes frames written by BME280Encoder.
+class BME280Decoder
+{
+public:
+
+   BME280Decoder();
+
+   /////////////////////////////////////////////////////////////////
+   /// Decode the frame at the start of buffer.
+   /// @param valid  set to false if the frame was consumed but the
+   ///          sample is unknown because earlier frames were lost.
+   /// @return number of bytes consumed, 0 if buffer does not hold a
+   ///          complete frame.
+   size_t decode(
+      const uint8_t buffer[],
+      size_t length,
+      int32_t& pressure,
+      int32_t& temperature,
+      int32_t& humidity,
+      bool& valid);
+
+   /////////////////////////////////////////////////////////////////
+   /// Discard frames until the next keyframe.
+   void reset();
+
+private:
+
+   bool m_synchronized;
+   uint16_t m_sequence;
+   int32_t m_last[3];
+   int32_t m_delta[3];
+};
+
+#endif // TG_BME_280_CODEC_H
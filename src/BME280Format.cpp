@@ -0,0 +1,461 @@
+/*
+BME280Format.cpp
+This code formats samples as text into caller provided buffers.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This header must be included in any derived code or copies of the code.
+
+ */
+
+#include "BME280Format.h"
+
+#include <math.h>
+
+static const uint8_t MAX_DECIMALS = 9;
+
+static const uint32_t POW10[MAX_DECIMALS + 1] =
+{
+   1, 10, 100, 1000, 10000, 100000, 1000000,
+   10000000, 100000000, 1000000000
+};
+
+// "00" to "99", two digits per division.
+static const char DIGITS[] =
+   "00010203040506070809"
+   "10111213141516171819"
+   "20212223242526272829"
+   "30313233343536373839"
+   "40414243444546474849"
+   "50515253545556575859"
+   "60616263646566676869"
+   "70717273747576777879"
+   "80818283848586878889"
+   "90919293949596979899";
+
+// Pressure in Pa to the unit with decimals, value = Pa * num / den.
+// The factors are those of BME280::CalculatePressure.
+struct PresConversion
+{
+   uint8_t decimals;
+   int64_t num;
+   int64_t den;
+};
+
+static const PresConversion PRES_CONVERSIONS[] =
+{
+   { 0, 1, 1 },                                 // Pa
+   { 2, 1, 1 },                                 // hPa
+   { 4, 100000000000LL, 33863752578LL },        // inHg
+   { 5, 100000000000LL, 101324997664LL },       // atm
+   { 5, 1, 1 },                                 // bar
+   { 2, 1, 1 },                                 // mbar
+   { 2, 1000000000000LL, 1333223653467LL },     // torr
+   { 4, 1000000000000LL, 689474482549LL }       // psi
+};
+
+static const char* const PRES_NAMES[] =
+{
+   "Pa", "hPa", "inHg", "atm", "bar", "mbar", "torr", "psi"
+};
+
+static const uint8_t TEMP_DECIMALS = 2;
+static const uint8_t HUM_DECIMALS = 2;
+
+
+/****************************************************************/
+BME280Format::BME280Format
+(
+   char buffer[],
+   size_t size,
+   Format format,
+   BME280::TempUnit tempUnit,
+   BME280::PresUnit presUnit
+):m_buffer(buffer),
+  m_size(size),
+  m_length(0),
+  m_overflow(false),
+  m_format(format),
+  m_tempUnit(tempUnit),
+  m_presUnit(presUnit),
+  m_measurement("bme280"),
+  m_tags(NULL)
+{
+   if(m_size > 0) { m_buffer[0] = '\0'; }
+}
+
+
+/****************************************************************/
+void BME280Format::setFormat
+(
+   Format format
+)
+{
+   m_format = format;
+}
+
+
+/****************************************************************/
+void BME280Format::setUnits
+(
+   BME280::TempUnit tempUnit,
+   BME280::PresUnit presUnit
+)
+{
+   m_tempUnit = tempUnit;
+   m_presUnit = presUnit;
+}
+
+
+/****************************************************************/
+void BME280Format::setMeasurement
+(
+   const char* measurement,
+   const char* tags
+)
+{
+   m_measurement = measurement;
+   m_tags = tags;
+}
+
+
+/****************************************************************/
+void BME280Format::clear()
+{
+   m_length = 0;
+   m_overflow = false;
+   if(m_size > 0) { m_buffer[0] = '\0'; }
+}
+
+
+/****************************************************************/
+bool BME280Format::header()
+{
+   if(m_format != Format_Csv) { return true; }
+
+   size_t start = m_length;
+   bool ok = append("pressure_") &&
+      append(PRES_NAMES[m_presUnit]) &&
+      append(m_tempUnit == BME280::TempUnit_Celsius ?
+         ",temperature_C" : ",temperature_F") &&
+      append(",humidity_%RH");
+
+   return ok || Rollback(start);
+}
+
+
+/****************************************************************/
+bool BME280Format::sample
+(
+   uint32_t pressure,
+   int32_t temperature,
+   uint32_t humidity
+)
+{
+   int32_t values[3];
+   bool valid[3] = { true, true, true };
+
+   const PresConversion& conversion = PRES_CONVERSIONS[m_presUnit];
+   int64_t scaled = pressure;
+   if(conversion.den != 1)
+   {
+      scaled = (scaled * conversion.num + conversion.den / 2) / conversion.den;
+   }
+   values[0] = scaled;
+
+   if(m_tempUnit == BME280::TempUnit_Fahrenheit)
+   {
+      int32_t t = temperature * 9;
+      values[1] = (t >= 0 ? t + 2 : t - 2) / 5 + 3200;
+   }
+   else
+   {
+      values[1] = temperature;
+   }
+
+   values[2] = (uint32_t)(((uint64_t)humidity * 100 + 512) >> 10);
+
+   return Record(values, valid);
+}
+
+
+/****************************************************************/
+bool BME280Format::sample
+(
+   float pressure,
+   float temperature,
+   float humidity
+)
+{
+   int32_t values[3];
+   bool valid[3];
+
+   valid[0] = Scale(pressure, PRES_CONVERSIONS[m_presUnit].decimals, values[0]);
+   valid[1] = Scale(temperature, TEMP_DECIMALS, values[1]);
+   valid[2] = Scale(humidity, HUM_DECIMALS, values[2]);
+
+   return Record(values, valid);
+}
+
+
+/****************************************************************/
+bool BME280Format::append
+(
+   const char* text
+)
+{
+   size_t start = m_length;
+   while(*text != '\0')
+   {
+      if(!Put(*text++)) { return Rollback(start); }
+   }
+   return true;
+}
+
+
+/****************************************************************/
+bool BME280Format::appendInteger
+(
+   int32_t value
+)
+{
+   return appendFixed(value, 0);
+}
+
+
+/****************************************************************/
+bool BME280Format::appendFixed
+(
+   int32_t value,
+   uint8_t decimals
+)
+{
+   if(decimals > MAX_DECIMALS) { decimals = MAX_DECIMALS; }
+
+   size_t start = m_length;
+   uint32_t magnitude = value < 0 ? 0u - (uint32_t)value : (uint32_t)value;
+   uint32_t whole = magnitude / POW10[decimals];
+   uint32_t fraction = magnitude - whole * POW10[decimals];
+
+   bool ok = (value >= 0 || Put('-')) && PutUnsigned(whole);
+   if(ok && decimals > 0)
+   {
+      // Write the fraction with its leading zeros, back to front.
+      ok = Put('.');
+      size_t end = m_length + decimals;
+      for(uint8_t i = 0; ok && i < decimals; ++i) { ok = Put('0'); }
+      for(size_t i = end; ok && fraction != 0; i -= 2)
+      {
+         uint32_t pair = fraction % 100;
+         fraction /= 100;
+         m_buffer[i - 1] = DIGITS[2 * pair + 1];
+         if(i - 2 >= end - decimals) { m_buffer[i - 2] = DIGITS[2 * pair]; }
+      }
+   }
+
+   return ok || Rollback(start);
+}
+
+
+/****************************************************************/
+bool BME280Format::appendFloat
+(
+   float value,
+   uint8_t decimals
+)
+{
+   if(decimals > MAX_DECIMALS) { decimals = MAX_DECIMALS; }
+
+   int32_t scaled;
+   if(!Scale(value, decimals, scaled)) { return append("nan"); }
+   return appendFixed(scaled, decimals);
+}
+
+
+/****************************************************************/
+const char* BME280Format::c_str() const
+{
+   return m_buffer;
+}
+
+
+/****************************************************************/
+size_t BME280Format::length() const
+{
+   return m_length;
+}
+
+
+/****************************************************************/
+bool BME280Format::overflow() const
+{
+   return m_overflow;
+}
+
+
+/****************************************************************/
+bool BME280Format::Put
+(
+   char c
+)
+{
+   if(m_length + 1 >= m_size) { return false; }
+   m_buffer[m_length++] = c;
+   m_buffer[m_length] = '\0';
+   return true;
+}
+
+
+/****************************************************************/
+bool BME280Format::PutUnsigned
+(
+   uint32_t value
+)
+{
+   // Ten digits at most, written back to front.
+   char digits[10];
+   uint8_t count = 0;
+
+   while(value >= 100)
+   {
+      uint32_t pair = value % 100;
+      value /= 100;
+      digits[count++] = DIGITS[2 * pair + 1];
+      digits[count++] = DIGITS[2 * pair];
+   }
+   if(value >= 10)
+   {
+      digits[count++] = DIGITS[2 * value + 1];
+      digits[count++] = DIGITS[2 * value];
+   }
+   else
+   {
+      digits[count++] = '0' + value;
+   }
+
+   if(m_length + count >= m_size) { return false; }
+   while(count > 0) { m_buffer[m_length++] = digits[--count]; }
+   m_buffer[m_length] = '\0';
+   return true;
+}
+
+
+/****************************************************************/
+bool BME280Format::Field
+(
+   const char* name,
+   int32_t value,
+   uint8_t decimals,
+   bool valid,
+   bool& first
+)
+{
+   switch(m_format)
+   {
+      case Format_Json:
+         if(!append(first ? "{\"" : ",\"") || !append(name) || !append("\":"))
+         {
+            return false;
+         }
+         first = false;
+         return valid ? appendFixed(value, decimals) : append("null");
+
+      case Format_Influx:
+         if(!valid) { return true; }
+         if(!Put(first ? ' ' : ',') || !append(name) || !Put('='))
+         {
+            return false;
+         }
+         first = false;
+         return appendFixed(value, decimals);
+
+      case Format_Csv:
+      default:
+         if(!first && !Put(',')) { return false; }
+         first = false;
+         return !valid || appendFixed(value, decimals);
+   }
+}
+
+
+/****************************************************************/
+bool BME280Format::Record
+(
+   const int32_t values[3],
+   const bool valid[3]
+)
+{
+   size_t start = m_length;
+   bool first = true;
+
+   if(m_format == Format_Influx)
+   {
+      if(!append(m_measurement)) { return Rollback(start); }
+      if(m_tags != NULL && (!Put(',') || !append(m_tags)))
+      {
+         return Rollback(start);
+      }
+   }
+
+   bool ok = Field("pressure", values[0],
+         PRES_CONVERSIONS[m_presUnit].decimals, valid[0], first) &&
+      Field("temperature", values[1], TEMP_DECIMALS, valid[1], first) &&
+      Field("humidity", values[2], HUM_DECIMALS, valid[2], first);
+
+   if(ok && m_format == Format_Json) { ok = Put('}'); }
+
+   // A line protocol line needs at least one field.
+   if(ok && m_format == Format_Influx && first)
+   {
+      m_length = start;
+      m_buffer[m_length] = '\0';
+      return false;
+   }
+
+   return ok || Rollback(start);
+}
+
+
+/****************************************************************/
+bool BME280Format::Rollback
+(
+   size_t start
+)
+{
+   m_length = start;
+   if(m_size > 0) { m_buffer[m_length] = '\0'; }
+   m_overflow = true;
+   return false;
+}
+
+
+/****************************************************************/
+bool BME280Format::Scale
+(
+   float value,
+   uint8_t decimals,
+   int32_t& scaled
+)
+{
+   float result = value * POW10[decimals];
+   if(!(result > -2147483520.0f && result < 2147483520.0f)) { return false; }
+
+   scaled = (int32_t)(result >= 0.0f ? result + 0.5f : result - 0.5f);
+   return true;
+}
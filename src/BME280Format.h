@@ -0,0 +1,210 @@
+/*
+
+BME280Format.h
+
+This code formats samples as text into caller provided buffers.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This code is licensed under the GNU LGPL and is open for ditrbution
+and copying in accordance with the license.
+This header must be included in any derived code or copies of the code.
+
+Numbers are converted with integer arithmetic, two digits per step,
+instead of printf or String. Floats are scaled and rounded to an
+integer first. Nothing is allocated; a record that does not fit is
+removed whole and overflow() is set.
+
+ */
+
+#ifndef TG_BME_280_FORMAT_H
+#define TG_BME_280_FORMAT_H
+
+#include "BME280.h"
+
+//////////////////////////////////////////////////////////////////
+/// BME280Format - Samples as CSV, JSON or InfluxDB line protocol.
+///
+/// Records are appended to the buffer without a line end, e.g.
+///
+///   CSV     1013.25,21.50,45.12
+///   JSON    {"pressure":1013.25,"temperature":21.50,"humidity":45.12}
+///   Influx  bme280,room=lab pressure=1013.25,temperature=21.50,humidity=45.12
+///
+/// Pressures have a fixed number of decimals per unit, about 1 Pa,
+/// temperatures and humidities 2. A NAN value is an empty CSV field,
+/// null in JSON and left out of an Influx line.
+///
+class BME280Format
+{
+public:
+
+   enum Format
+   {
+      Format_Csv,
+      Format_Json,
+      Format_Influx
+   };
+
+   /////////////////////////////////////////////////////////////////
+   /// Constructor used to create the class. buffer holds size - 1
+   /// characters and the terminating null.
+   BME280Format(
+      char buffer[],
+      size_t size,
+      Format format = Format_Csv,
+      BME280::TempUnit tempUnit = BME280::TempUnit_Celsius,
+      BME280::PresUnit presUnit = BME280::PresUnit_hPa);
+
+   /////////////////////////////////////////////////////////////////
+   /// Set the format of the following records.
+   void setFormat(
+      Format format);
+
+   /////////////////////////////////////////////////////////////////
+   /// Set the units of the following records. Float samples must be
+   /// read in these units, integer samples are converted.
+   void setUnits(
+      BME280::TempUnit tempUnit,
+      BME280::PresUnit presUnit);
+
+   /////////////////////////////////////////////////////////////////
+   /// Set the InfluxDB measurement, default "bme280", and the tags,
+   /// e.g. "room=lab,node=3", or null. Both must outlive the format.
+   void setMeasurement(
+      const char* measurement,
+      const char* tags = NULL);
+
+   /////////////////////////////////////////////////////////////////
+   /// Empty the buffer and clear overflow().
+   void clear();
+
+   /////////////////////////////////////////////////////////////////
+   /// Append the CSV column names with their units. Does nothing
+   /// for the other formats. Return false if it does not fit.
+   bool header();
+
+   /////////////////////////////////////////////////////////////////
+   /// Append a record of the integer results of BME280::read(
+   /// uint32_t&, int32_t&, uint32_t&): pressure in Pa, temperature in
+   /// 0.01 °C and humidity in %RH * 1024. Return false if it does
+   /// not fit.
+   bool sample(
+      uint32_t pressure,
+      int32_t temperature,
+      uint32_t humidity);
+
+   /////////////////////////////////////////////////////////////////
+   /// Append a record of the results of BME280::read(float&, float&,
+   /// float&, TempUnit, PresUnit) in the units set. Return false if
+   /// it does not fit.
+   bool sample(
+      float pressure,
+      float temperature,
+      float humidity);
+
+   /////////////////////////////////////////////////////////////////
+   /// Append text, e.g. a separator or a line end.
+   bool append(
+      const char* text);
+
+   /////////////////////////////////////////////////////////////////
+   /// Append an integer, e.g. a time stamp.
+   bool appendInteger(
+      int32_t value);
+
+   /////////////////////////////////////////////////////////////////
+   /// Append value / 10^decimals with all decimals, up to 9.
+   bool appendFixed(
+      int32_t value,
+      uint8_t decimals);
+
+   /////////////////////////////////////////////////////////////////
+   /// Append a float rounded to decimals, up to 9. Values beyond
+   /// 2^31 / 10^decimals are written as nan.
+   bool appendFloat(
+      float value,
+      uint8_t decimals);
+
+   /////////////////////////////////////////////////////////////////
+   /// Return the null terminated text.
+   const char* c_str() const;
+
+   /////////////////////////////////////////////////////////////////
+   /// Return the number of characters in the buffer.
+   size_t length() const;
+
+   /////////////////////////////////////////////////////////////////
+   /// Return true if a record did not fit since the last clear().
+   bool overflow() const;
+
+private:
+
+   /////////////////////////////////////////////////////////////////
+   /// Append a character, false if the buffer is full.
+   bool Put(
+      char c);
+
+   /////////////////////////////////////////////////////////////////
+   /// Append the digits of value.
+   bool PutUnsigned(
+      uint32_t value);
+
+   /////////////////////////////////////////////////////////////////
+   /// Append a field, with its name and separator for the format.
+   /// An invalid value is written as missing.
+   bool Field(
+      const char* name,
+      int32_t value,
+      uint8_t decimals,
+      bool valid,
+      bool& first);
+
+   /////////////////////////////////////////////////////////////////
+   /// Append the fields of a record between the start and the end
+   /// of the format, or remove the record if it does not fit.
+   bool Record(
+      const int32_t values[3],
+      const bool valid[3]);
+
+   /////////////////////////////////////////////////////////////////
+   /// Remove everything after start and set overflow, return false.
+   bool Rollback(
+      size_t start);
+
+   /////////////////////////////////////////////////////////////////
+   /// Scale a float by 10^decimals, false if it is nan or too large.
+   static bool Scale(
+      float value,
+      uint8_t decimals,
+      int32_t& scaled);
+
+   char* m_buffer;
+   size_t m_size;
+   size_t m_length;
+   bool m_overflow;
+
+   Format m_format;
+   BME280::TempUnit m_tempUnit;
+   BME280::PresUnit m_presUnit;
+   const char* m_measurement;
+   const char* m_tags;
+};
+
+#endif // TG_BME_280_FORMAT_H
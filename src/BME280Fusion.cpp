@@ -0,0 +1,307 @@
+/*
+BME280Fusion.cpp
+This code fuses the samples of redundant BME280 sensors.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This header must be included in any derived code or copies of the code.
+
+ */
+
+#include "BME280Fusion.h"
+
+// Biases move by 1/64 of the difference per read.
+static const uint8_t BIAS_SHIFT = 6;
+
+
+/****************************************************************/
+static int32_t Divide
+(
+   int32_t value,
+   int32_t divisor
+)
+{
+   // Rounded to the nearest.
+   return (value < 0 ? value - divisor / 2 : value + divisor / 2) / divisor;
+}
+
+
+/****************************************************************/
+static int32_t Median
+(
+   int32_t values[],
+   uint8_t count
+)
+{
+   // Insertion sort, there are at most MAX_SENSORS.
+   for(uint8_t i = 1; i < count; ++i)
+   {
+      int32_t value = values[i];
+      uint8_t j = i;
+      for(; j > 0 && values[j - 1] > value; --j)
+      {
+         values[j] = values[j - 1];
+      }
+      values[j] = value;
+   }
+
+   return count & 1 ? values[count / 2] :
+      Divide(values[count / 2 - 1] + values[count / 2], 2);
+}
+
+
+/****************************************************************/
+BME280Fusion::BME280Fusion
+(
+   BME280* sensors[],
+   uint8_t count
+):m_count(count > MAX_SENSORS ? MAX_SENSORS : count)
+{
+   for(uint8_t i = 0; i < m_count; ++i)
+   {
+      m_sensors[i] = sensors[i];
+   }
+
+   setTolerances(PRESSURE_TOLERANCE, TEMPERATURE_TOLERANCE, HUMIDITY_TOLERANCE);
+   reset();
+}
+
+
+/****************************************************************/
+void BME280Fusion::setTolerances
+(
+   int32_t pressure,
+   int32_t temperature,
+   int32_t humidity
+)
+{
+   m_tolerances[Quantity_Pressure] = pressure;
+   m_tolerances[Quantity_Temperature] = temperature;
+   m_tolerances[Quantity_Humidity] = humidity;
+}
+
+
+/****************************************************************/
+void BME280Fusion::reset()
+{
+   for(uint8_t i = 0; i < MAX_SENSORS; ++i)
+   {
+      for(uint8_t q = 0; q < Quantity_Count; ++q)
+      {
+         m_biases[i][q] = 0;
+      }
+      m_reads[i] = 0;
+      m_failures[i] = 0;
+      m_rejections[i] = 0;
+   }
+}
+
+
+/****************************************************************/
+bool BME280Fusion::read
+(
+   Sample& sample
+)
+{
+   int32_t values[Quantity_Count][MAX_SENSORS];
+   uint8_t masks[Quantity_Count] = { 0, 0, 0 };
+
+   sample.failed = 0;
+   sample.rejected = 0;
+
+   // Start every conversion before waiting for any.
+   for(uint8_t i = 0; i < m_count; ++i)
+   {
+      if(!m_sensors[i]->trigger()) { sample.failed |= 1 << i; }
+   }
+
+   for(uint8_t i = 0; i < m_count; ++i)
+   {
+      uint32_t pressure, humidity;
+      int32_t temperature;
+
+      ++m_reads[i];
+      if((sample.failed & (1 << i)) ||
+         !m_sensors[i]->read(pressure, temperature, humidity))
+      {
+         sample.failed |= 1 << i;
+         ++m_failures[i];
+         continue;
+      }
+
+      values[Quantity_Pressure][i] = pressure;
+      values[Quantity_Temperature][i] = temperature;
+      values[Quantity_Humidity][i] = humidity;
+      masks[Quantity_Pressure] |= 1 << i;
+      masks[Quantity_Temperature] |= 1 << i;
+      if(m_sensors[i]->chipModel() != BME280::ChipModel_BMP280)
+      {
+         masks[Quantity_Humidity] |= 1 << i;
+      }
+   }
+
+   if(masks[Quantity_Pressure] == 0)
+   {
+      sample.health = Health_Failed;
+      return false;
+   }
+
+   int32_t fused[Quantity_Count] = { 0, 0, 0 };
+   bool verified = true;
+
+   for(uint8_t q = 0; q < Quantity_Count; ++q)
+   {
+      if(masks[q] == 0) { continue; }
+
+      int32_t spread;
+      uint8_t accepted = Vote(q, values[q], masks[q], fused[q], spread);
+      sample.rejected |= masks[q] & ~accepted;
+
+      // Two sensors are needed to tell which one is off.
+      if((accepted & (accepted - 1)) == 0 || spread > m_tolerances[q])
+      {
+         verified = false;
+      }
+   }
+
+   for(uint8_t i = 0; i < m_count; ++i)
+   {
+      if(sample.rejected & (1 << i)) { ++m_rejections[i]; }
+   }
+
+   sample.pressure = fused[Quantity_Pressure];
+   sample.temperature = fused[Quantity_Temperature];
+   sample.humidity = fused[Quantity_Humidity];
+
+   if(!verified)                                       { sample.health = Health_Unverified; }
+   else if(sample.failed != 0 || sample.rejected != 0) { sample.health = Health_Degraded; }
+   else                                                { sample.health = Health_Ok; }
+
+   return true;
+}
+
+
+/****************************************************************/
+uint8_t BME280Fusion::Vote
+(
+   uint8_t quantity,
+   const int32_t values[],
+   uint8_t mask,
+   int32_t& fused,
+   int32_t& spread
+)
+{
+   int32_t corrected[MAX_SENSORS];
+   int32_t sorted[MAX_SENSORS];
+   int32_t deviations[MAX_SENSORS];
+   uint8_t count = 0;
+
+   for(uint8_t i = 0; i < m_count; ++i)
+   {
+      if(!(mask & (1 << i))) { continue; }
+
+      corrected[i] = values[i] - Divide(m_biases[i][quantity], 1 << BIAS_SHIFT);
+      sorted[count++] = corrected[i];
+   }
+
+   int32_t median = Median(sorted, count);
+   uint8_t n = 0;
+   for(uint8_t i = 0; i < m_count; ++i)
+   {
+      if(!(mask & (1 << i))) { continue; }
+
+      int32_t deviation = corrected[i] - median;
+      deviations[n++] = deviation < 0 ? -deviation : deviation;
+   }
+   int32_t mad = Median(deviations, count);
+
+   // Reject beyond 3 standard deviations, 4.5 MAD, and the tolerance.
+   uint8_t accepted = 0;
+   int64_t sum = 0;
+   int32_t low = 0, high = 0;
+   n = 0;
+   for(uint8_t i = 0; i < m_count; ++i)
+   {
+      if(!(mask & (1 << i))) { continue; }
+
+      int32_t deviation = corrected[i] - median;
+      if(deviation < 0) { deviation = -deviation; }
+      if(2 * (int64_t)deviation > 9 * (int64_t)mad && deviation > m_tolerances[quantity])
+      {
+         continue;
+      }
+
+      if(n == 0 || corrected[i] < low) { low = corrected[i]; }
+      if(n == 0 || corrected[i] > high) { high = corrected[i]; }
+      accepted |= 1 << i;
+      sum += corrected[i];
+      ++n;
+   }
+   spread = high - low;
+
+   fused = (int32_t)((sum < 0 ? sum - n / 2 : sum + n / 2) / n);
+   if(n < 2) { return accepted; }
+
+   // The bias of each accepted sensor moves toward its difference from
+   // the fused value, then those biases are centered on zero. Rejected
+   // sensors keep their bias, so a failed sensor is not pulled back
+   // onto the fused value and stays rejected until it agrees on its
+   // own. A bias never exceeds the tolerance.
+   int32_t limit = m_tolerances[quantity] << BIAS_SHIFT;
+   int32_t total = 0;
+   for(uint8_t i = 0; i < m_count; ++i)
+   {
+      if(!(accepted & (1 << i))) { continue; }
+
+      int32_t& bias = m_biases[i][quantity];
+      bias += (values[i] - fused) - Divide(bias, 1 << BIAS_SHIFT);
+      total += bias;
+   }
+   int32_t mean = Divide(total, n);
+   for(uint8_t i = 0; i < m_count; ++i)
+   {
+      if(!(accepted & (1 << i))) { continue; }
+
+      int32_t& bias = m_biases[i][quantity];
+      bias -= mean;
+      if(bias > limit) { bias = limit; }
+      if(bias < -limit) { bias = -limit; }
+   }
+
+   return accepted;
+}
+
+
+/****************************************************************/
+BME280Fusion::SensorStatus BME280Fusion::status
+(
+   uint8_t index
+) const
+{
+   SensorStatus status = { 0, 0, 0, 0, 0, 0 };
+   if(index >= m_count) { return status; }
+
+   status.reads = m_reads[index];
+   status.failures = m_failures[index];
+   status.rejections = m_rejections[index];
+   status.pressureBias = Divide(m_biases[index][Quantity_Pressure], 1 << BIAS_SHIFT);
+   status.temperatureBias = Divide(m_biases[index][Quantity_Temperature], 1 << BIAS_SHIFT);
+   status.humidityBias = Divide(m_biases[index][Quantity_Humidity], 1 << BIAS_SHIFT);
+   return status;
+}
@@ -0,0 +1,159 @@
+/*
+
+BME280Fusion.h
+
+This code fuses the samples of redundant BME280 sensors.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This code is licensed under the GNU LGPL and is open for ditrbution
+and copying in accordance with the license.
+This header must be included in any derived code or copies of the code.
+
+ */
+
+#ifndef TG_BME_280_FUSION_H
+#define TG_BME_280_FUSION_H
+
+#include "BME280.h"
+
+//////////////////////////////////////////////////////////////////
+/// BME280Fusion - One sample from a group of redundant sensors.
+///
+/// All sensors are triggered first and then read, so in forced mode
+/// they convert at the same time and only the first read waits. Each
+/// quantity is voted on separately: the values, corrected by the bias
+/// of their sensor, are compared to their median and a value further
+/// than 4.5 median absolute deviations, and than the quantity's
+/// tolerance, is rejected. The fused value is the mean of the rest.
+/// While at least two values are accepted the bias of each accepted
+/// sensor slowly tracks its difference from the fused value, up to
+/// the tolerance, so a constant offset between sensors is learned. The
+/// biases of the accepted sensors average to zero, the fused value
+/// stays their mean. A rejected sensor keeps its bias and stays
+/// rejected, and the sample degraded, until it agrees again.
+///
+class BME280Fusion
+{
+public:
+
+   static const uint8_t MAX_SENSORS = 4;
+
+   enum Health
+   {
+      Health_Ok,              // all sensors read and agree
+      Health_Degraded,        // a sensor failed or was rejected, the rest agree
+      Health_Unverified,      // a quantity from one sensor, or two that disagree
+      Health_Failed           // no sensor could be read
+   };
+
+   /////////////////////////////////////////////////////////////////
+   /// Fused sample, the units of BME280::read(uint32_t&, int32_t&,
+   /// uint32_t&).
+   struct Sample
+   {
+      uint32_t pressure;      // Pa
+      int32_t temperature;    // 0.01 °C
+      uint32_t humidity;      // %RH * 1024
+      Health health;
+      uint8_t failed;         // bit per sensor that could not be read
+      uint8_t rejected;       // bit per sensor with a rejected value
+   };
+
+   /////////////////////////////////////////////////////////////////
+   /// Counters and biases of one sensor.
+   struct SensorStatus
+   {
+      uint32_t reads;
+      uint32_t failures;
+      uint32_t rejections;
+      int32_t pressureBias;       // Pa
+      int32_t temperatureBias;    // 0.01 °C
+      int32_t humidityBias;       // %RH * 1024
+   };
+
+   /////////////////////////////////////////////////////////////////
+   /// Default tolerances, about the relative accuracy of the sensor.
+   static const int32_t PRESSURE_TOLERANCE = 50;        // Pa
+   static const int32_t TEMPERATURE_TOLERANCE = 50;     // 0.01 °C
+   static const int32_t HUMIDITY_TOLERANCE = 2 * 1024;  // %RH * 1024
+
+   /////////////////////////////////////////////////////////////////
+   /// Constructor used to create the class. sensors must be begun
+   /// by the caller and outlive the fusion, at most MAX_SENSORS.
+   /// Sensors without humidity, BMP280, are left out of humidity.
+   BME280Fusion(
+      BME280* sensors[],
+      uint8_t count);
+
+   /////////////////////////////////////////////////////////////////
+   /// Set the differences between sensors that are never rejected.
+   void setTolerances(
+      int32_t pressure,
+      int32_t temperature,
+      int32_t humidity);
+
+   /////////////////////////////////////////////////////////////////
+   /// Read all sensors and fuse them. Return false if no sensor
+   /// could be read.
+   bool read(
+      Sample& sample);
+
+   /////////////////////////////////////////////////////////////////
+   /// Return the status of sensor index.
+   SensorStatus status(
+      uint8_t index) const;
+
+   /////////////////////////////////////////////////////////////////
+   /// Forget the biases and counters.
+   void reset();
+
+private:
+
+   enum Quantity
+   {
+      Quantity_Pressure,
+      Quantity_Temperature,
+      Quantity_Humidity,
+      Quantity_Count
+   };
+
+   /////////////////////////////////////////////////////////////////
+   /// Vote on one quantity of the sensors in mask, return the mask of
+   /// the accepted sensors, their fused value and the difference
+   /// between the highest and lowest.
+   uint8_t Vote(
+      uint8_t quantity,
+      const int32_t values[],
+      uint8_t mask,
+      int32_t& fused,
+      int32_t& spread);
+
+   BME280* m_sensors[MAX_SENSORS];
+   uint8_t m_count;
+   int32_t m_tolerances[Quantity_Count];
+
+   // Biases scaled by 2^BIAS_SHIFT, see Vote().
+   int32_t m_biases[MAX_SENSORS][Quantity_Count];
+   uint32_t m_reads[MAX_SENSORS];
+   uint32_t m_failures[MAX_SENSORS];
+   uint32_t m_rejections[MAX_SENSORS];
+};
+
+#endif // TG_BME_280_FUSION_H
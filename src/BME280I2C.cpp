@@ -71,9 +71,23 @@ bool BME280I2C::WriteRegister
   Wire.beginTransmission(m_settings.bme280Addr);
   Wire.write(addr);
   Wire.write(data);
-  Wire.endTransmission();
 
-  return true; // TODO: Check return values from wire calls.
+  return Wire.endTransmission() == 0;
+}
+
+
+/****************************************************************/
+bool BME280I2C::WriteRegisters
+(
+  const uint8_t pairs[],
+  uint8_t count
+)
+{
+  // The BME280 takes any number of address and data pairs in one write.
+  Wire.beginTransmission(m_settings.bme280Addr);
+  Wire.write(pairs, 2 * count);
+
+  return Wire.endTransmission() == 0;
 }
 
 
@@ -87,9 +101,14 @@ bool BME280I2C::ReadRegister
 {
   uint8_t ord(0);
 
+  // Repeated start, so no other master can access the bus between
+  // the address and the data.
   Wire.beginTransmission(m_settings.bme280Addr);
   Wire.write(addr);
-  Wire.endTransmission();
+  if(Wire.endTransmission(false) != 0)
+  {
+    return false;
+  }
 
   Wire.requestFrom(static_cast<uint8_t>(m_settings.bme280Addr), length);
 
@@ -84,16 +84,18 @@ public:
 
 protected:
 
-private:
-
-   Settings m_settings;
-
    //////////////////////////////////////////////////////////////////
    /// Write values to BME280 registers.
    virtual bool WriteRegister(
       uint8_t addr,
       uint8_t data);
 
+   //////////////////////////////////////////////////////////////////
+   /// Write several BME280 registers in one transaction.
+   virtual bool WriteRegisters(
+      const uint8_t pairs[],
+      uint8_t count);
+
    /////////////////////////////////////////////////////////////////
    /// Read values from BME280 registers.
    virtual bool ReadRegister(
@@ -101,5 +103,9 @@ private:
       uint8_t data[],
       uint8_t length);
 
+private:
+
+   Settings m_settings;
+
 };
 #endif // TG_BME_280_I2C_H
@@ -42,7 +42,8 @@ BME280I2C_BRZO::BME280I2C_BRZO
 (
   const Settings& settings
 ):BME280I2C(settings),
-  m_settings(settings)
+  m_settings(settings),
+  m_lastError(0)
 {
 }
 
@@ -64,6 +65,13 @@ const BME280I2C_BRZO::Settings& BME280I2C_BRZO::getSettings() const
 }
 
 
+/****************************************************************/
+uint8_t BME280I2C_BRZO::lastError() const
+{
+   return m_lastError;
+}
+
+
 /****************************************************************/
 bool BME280I2C_BRZO::WriteRegister
 (
@@ -74,9 +82,21 @@ bool BME280I2C_BRZO::WriteRegister
     uint8_t bf[2];
     bf[0] = addr;
     bf[1] = data;
+    return BME280I2C_BRZO::WriteRegisters(bf, 1);
+}
+
+/****************************************************************/
+bool BME280I2C_BRZO::WriteRegisters
+(
+  const uint8_t pairs[],
+  uint8_t count
+)
+{
+    // The BME280 takes any number of address and data pairs in one write.
     brzo_i2c_start_transaction(m_settings.bme280Addr, m_settings.i2cClockRate);
-    brzo_i2c_write(bf, 2, false);
-    return (brzo_i2c_end_transaction()==0);
+    brzo_i2c_write(const_cast<uint8_t*>(pairs), 2 * count, false);
+    m_lastError = brzo_i2c_end_transaction();
+    return m_lastError == 0;
 }
 
 /****************************************************************/
@@ -87,11 +107,13 @@ bool BME280I2C_BRZO::ReadRegister
   uint8_t length
 )
 {
+    // One transaction, the read follows the address with a repeated start.
+    // brzo_i2c_end_transaction() reports errors of the whole transaction.
     brzo_i2c_start_transaction(m_settings.bme280Addr, m_settings.i2cClockRate);
     brzo_i2c_write(&addr, 1, true);
     brzo_i2c_read(data, length, false);
-    brzo_i2c_end_transaction();
-    return (brzo_i2c_end_transaction()==0);
+    m_lastError = brzo_i2c_end_transaction();
+    return m_lastError == 0;
 }
 
 #endif
@@ -77,12 +77,13 @@ public:
    /////////////////////////////////////////////////////////////////
    const Settings& getSettings() const;
 
+   /////////////////////////////////////////////////////////////////
+   /// Return the brzo_i2c_end_transaction() code of the last
+   /// register access, 0 if it succeeded.
+   uint8_t lastError() const;
 
-protected:
-
-private:
 
-   Settings m_settings;
+protected:
 
    //////////////////////////////////////////////////////////////////
    /// Write values to BME280 registers.
@@ -90,6 +91,12 @@ private:
       uint8_t addr,
       uint8_t data);
 
+   //////////////////////////////////////////////////////////////////
+   /// Write several BME280 registers in one transaction.
+   virtual bool WriteRegisters(
+      const uint8_t pairs[],
+      uint8_t count);
+
    /////////////////////////////////////////////////////////////////
    /// Read values from BME280 registers.
    virtual bool ReadRegister(
@@ -97,5 +104,10 @@ private:
       uint8_t data[],
       uint8_t length);
 
+private:
+
+   Settings m_settings;
+   uint8_t m_lastError;
+
 };
 #endif // BME280I2C_BRZO_H
@@ -0,0 +1,199 @@
+/*
+BME280Log.cpp
+This code encodes and decodes compact binary logs of raw BME280 samples.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This header must be included in any derived code or copies of the code.
+
+ */
+
+#include "BME280Log.h"
+
+#include <string.h>
+
+static const uint8_t MAGIC[4] = { 'B', 'M', 'E', 'L' };
+
+
+/****************************************************************/
+static void WriteUInt32
+(
+   uint8_t buffer[],
+   uint32_t value
+)
+{
+   buffer[0] = value;
+   buffer[1] = value >> 8;
+   buffer[2] = value >> 16;
+   buffer[3] = value >> 24;
+}
+
+
+/****************************************************************/
+static uint32_t ReadUInt32
+(
+   const uint8_t buffer[]
+)
+{
+   return (uint32_t)buffer[0] | ((uint32_t)buffer[1] << 8) |
+      ((uint32_t)buffer[2] << 16) | ((uint32_t)buffer[3] << 24);
+}
+
+
+/****************************************************************/
+int32_t BME280LogRecord::rawPressure() const
+{
+   return ((int32_t)data[0] << 12) | ((int32_t)data[1] << 4) | (data[2] >> 4);
+}
+
+
+/****************************************************************/
+int32_t BME280LogRecord::rawTemperature() const
+{
+   return ((int32_t)data[3] << 12) | ((int32_t)data[4] << 4) | (data[5] >> 4);
+}
+
+
+/****************************************************************/
+int32_t BME280LogRecord::rawHumidity() const
+{
+   return ((int32_t)data[6] << 8) | data[7];
+}
+
+
+/****************************************************************/
+BME280LogWriter::BME280LogWriter
+(
+):m_lastTimestamp(0)
+{
+}
+
+
+/****************************************************************/
+uint8_t BME280LogWriter::writeHeader
+(
+   uint8_t buffer[HEADER_LENGTH],
+   const BME280LogHeader& header
+)
+{
+   memcpy(&buffer[0], MAGIC, sizeof(MAGIC));
+   buffer[4] = VERSION;
+   buffer[5] = header.chipModel;
+   buffer[6] = header.ctrlHum;
+   buffer[7] = header.ctrlMeas;
+   buffer[8] = header.config;
+   buffer[9] = 0;
+   WriteUInt32(&buffer[10], header.timeResolution);
+   WriteUInt32(&buffer[14], header.startTime);
+   memcpy(&buffer[18], header.trim, sizeof(header.trim));
+
+   m_lastTimestamp = header.startTime;
+
+   return HEADER_LENGTH;
+}
+
+
+/****************************************************************/
+uint8_t BME280LogWriter::writeRecord
+(
+   uint8_t buffer[MAX_RECORD_LENGTH],
+   const uint8_t data[8],
+   uint32_t timestamp
+)
+{
+   uint8_t length = 8;
+   memcpy(buffer, data, length);
+
+   // Unsigned wrap around keeps deltas valid across a timer overflow.
+   uint32_t delta = timestamp - m_lastTimestamp;
+   m_lastTimestamp = timestamp;
+
+   while(delta >= 0x80)
+   {
+      buffer[length++] = (delta & 0x7F) | 0x80;
+      delta >>= 7;
+   }
+   buffer[length++] = delta;
+
+   return length;
+}
+
+
+/****************************************************************/
+BME280LogReader::BME280LogReader
+(
+):m_lastTimestamp(0)
+{
+}
+
+
+/****************************************************************/
+size_t BME280LogReader::readHeader
+(
+   const uint8_t buffer[],
+   size_t length,
+   BME280LogHeader& header
+)
+{
+   if(length < BME280LogWriter::HEADER_LENGTH ||
+      memcmp(buffer, MAGIC, sizeof(MAGIC)) != 0 ||
+      buffer[4] != BME280LogWriter::VERSION)
+   {
+      return 0;
+   }
+
+   header.chipModel = buffer[5];
+   header.ctrlHum = buffer[6];
+   header.ctrlMeas = buffer[7];
+   header.config = buffer[8];
+   header.timeResolution = ReadUInt32(&buffer[10]);
+   header.startTime = ReadUInt32(&buffer[14]);
+   memcpy(header.trim, &buffer[18], sizeof(header.trim));
+
+   m_lastTimestamp = header.startTime;
+
+   return BME280LogWriter::HEADER_LENGTH;
+}
+
+
+/****************************************************************/
+size_t BME280LogReader::readRecord
+(
+   const uint8_t buffer[],
+   size_t length,
+   BME280LogRecord& record
+)
+{
+   size_t ord = 8;
+   uint32_t delta = 0;
+   uint8_t shift = 0;
+
+   do
+   {
+      if(ord >= length || shift > 28) { return 0; }
+      delta |= (uint32_t)(buffer[ord] & 0x7F) << shift;
+      shift += 7;
+   } while(buffer[ord++] & 0x80);
+
+   memcpy(record.data, buffer, sizeof(record.data));
+   m_lastTimestamp += delta;
+   record.timestamp = m_lastTimestamp;
+
+   return ord;
+}
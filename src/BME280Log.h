@@ -0,0 +1,153 @@
+/*
+
+BME280Log.h
+
+This code encodes and decodes compact binary logs of raw BME280 samples.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This code is licensed under the GNU LGPL and is open for ditrbution
+and copying in accordance with the license.
+This header must be included in any derived code or copies of the code.
+
+Log layout, all multi-byte values little-endian:
+
+   Header (50 bytes)
+      0   'B' 'M' 'E' 'L'
+      4   version (1)
+      5   chip model (BME280::ChipModel)
+      6   ctrl_hum register
+      7   ctrl_meas register
+      8   config register
+      9   reserved (0)
+      10  uint32 time resolution in microseconds per tick
+      14  uint32 start time in ticks
+      18  32 byte trim block, as returned by BME280::trim()
+
+   Record (9 to 13 bytes)
+      0   8 raw data bytes, registers 0xF7 to 0xFE
+      8   time since the previous record (or the start time) in
+          ticks, unsigned LEB128 varint
+
+This file only depends on stdint so the same code reads logs on the
+target and on a host.
+
+ */
+
+#ifndef TG_BME_280_LOG_H
+#define TG_BME_280_LOG_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/////////////////////////////////////////////////////////////////
+/// Calibration and settings of the sensor a log was recorded from.
+struct BME280LogHeader
+{
+   uint8_t chipModel;
+   uint8_t ctrlHum;
+   uint8_t ctrlMeas;
+   uint8_t config;
+   uint32_t timeResolution;   // [us] per tick
+   uint32_t startTime;        // [ticks]
+   uint8_t trim[32];
+};
+
+/////////////////////////////////////////////////////////////////
+/// One raw sample.
+struct BME280LogRecord
+{
+   uint8_t data[8];
+   uint32_t timestamp;        // [ticks]
+
+   /////////////////////////////////////////////////////////////////
+   /// 20 bit raw pressure, temperature and 16 bit raw humidity.
+   int32_t rawPressure() const;
+   int32_t rawTemperature() const;
+   int32_t rawHumidity() const;
+};
+
+
+//////////////////////////////////////////////////////////////////
+/// BME280LogWriter - Encodes a header and raw records into caller
+/// provided buffers, ready to be written to a file or flash.
+class BME280LogWriter
+{
+public:
+
+   static const uint8_t VERSION             = 1;
+   static const uint8_t HEADER_LENGTH       = 50;
+   static const uint8_t MAX_RECORD_LENGTH   = 13;
+
+   BME280LogWriter();
+
+   /////////////////////////////////////////////////////////////////
+   /// Encode the header into buffer and restart the timestamp
+   /// deltas at header.startTime.
+   /// @return number of bytes written, HEADER_LENGTH.
+   uint8_t writeHeader(
+      uint8_t buffer[HEADER_LENGTH],
+      const BME280LogHeader& header);
+
+   /////////////////////////////////////////////////////////////////
+   /// Encode one record of raw data taken at timestamp.
+   /// @return number of bytes written, at most MAX_RECORD_LENGTH.
+   uint8_t writeRecord(
+      uint8_t buffer[MAX_RECORD_LENGTH],
+      const uint8_t data[8],
+      uint32_t timestamp);
+
+private:
+
+   uint32_t m_lastTimestamp;
+};
+
+
+//////////////////////////////////////////////////////////////////
+/// BME280LogReader - Decodes a log from consecutive chunks of bytes.
+class BME280LogReader
+{
+public:
+
+   BME280LogReader();
+
+   /////////////////////////////////////////////////////////////////
+   /// Decode the header from the start of buffer.
+   /// @return number of bytes consumed, 0 if buffer is too short or
+   ///          not a supported log.
+   size_t readHeader(
+      const uint8_t buffer[],
+      size_t length,
+      BME280LogHeader& header);
+
+   /////////////////////////////////////////////////////////////////
+   /// Decode the next record from the start of buffer.
+   /// @return number of bytes consumed, 0 if buffer does not hold a
+   ///          complete record.
+   size_t readRecord(
+      const uint8_t buffer[],
+      size_t length,
+      BME280LogRecord& record);
+
+private:
+
+   uint32_t m_lastTimestamp;
+};
+
+#endif // TG_BME_280_LOG_H
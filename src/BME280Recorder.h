@@ -0,0 +1,121 @@
+/*
+
+BME280Recorder.h
+
+This code records the bus session of any BME280 transport.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This code is licensed under the GNU LGPL and is open for ditrbution
+and copying in accordance with the license.
+This header must be included in any derived code or copies of the code.
+
+ */
+
+#ifndef TG_BME_280_RECORDER_H
+#define TG_BME_280_RECORDER_H
+
+#include "BME280.h"
+#include "BME280Session.h"
+
+//////////////////////////////////////////////////////////////////
+/// BME280Recorder - Wraps a transport such as BME280I2C or
+/// BME280Spi and records every register access it makes, with the
+/// data and a micros() timestamp, into a caller provided buffer.
+/// The session can be replayed on a host with BME280Replay.
+///
+/// BME280Recorder<BME280I2C> bme(buffer, sizeof(buffer));
+///
+template<class Transport>
+class BME280Recorder: public Transport
+{
+public:
+
+   ///////////////////////////////////////////////////////////////
+   /// Constructor used to create the class. Settings are passed to
+   /// the transport.
+   BME280Recorder(
+      uint8_t buffer[],
+      size_t size,
+      const typename Transport::Settings& settings = typename Transport::Settings()
+   ):Transport(settings),
+     m_session(buffer, size),
+     m_batch(false)
+   {
+   }
+
+   ///////////////////////////////////////////////////////////////
+   /// Return the session recorded so far.
+   BME280SessionWriter& session()
+   {
+      return m_session;
+   }
+
+protected:
+
+   ///////////////////////////////////////////////////////////////
+   virtual bool WriteRegister(
+      uint8_t addr,
+      uint8_t data)
+   {
+      bool success = Transport::WriteRegister(addr, data);
+      if(!m_batch)
+      {
+         m_session.write(addr, data, success, micros());
+      }
+      return success;
+   }
+
+   ///////////////////////////////////////////////////////////////
+   /// Recorded as one write per register, so the session replays
+   /// the same with transports that write them one by one.
+   virtual bool WriteRegisters(
+      const uint8_t pairs[],
+      uint8_t count)
+   {
+      m_batch = true;
+      bool success = Transport::WriteRegisters(pairs, count);
+      m_batch = false;
+
+      uint32_t timestamp = micros();
+      for(uint8_t i = 0; i < count; ++i)
+      {
+         m_session.write(pairs[2 * i], pairs[2 * i + 1], success, timestamp);
+      }
+      return success;
+   }
+
+   ///////////////////////////////////////////////////////////////
+   virtual bool ReadRegister(
+      uint8_t addr,
+      uint8_t data[],
+      uint8_t length)
+   {
+      bool success = Transport::ReadRegister(addr, data, length);
+      m_session.read(addr, data, length, success, micros());
+      return success;
+   }
+
+private:
+
+   BME280SessionWriter m_session;
+   bool m_batch;
+};
+
+#endif // TG_BME_280_RECORDER_H
@@ -0,0 +1,120 @@
+/*
+BME280Replay.cpp
+This code replays a recorded BME280 bus session.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This header must be included in any derived code or copies of the code.
+
+ */
+
+#include "BME280Replay.h"
+
+
+/****************************************************************/
+BME280Replay::BME280Replay
+(
+   const uint8_t session[],
+   size_t length,
+   const Settings& settings
+):BME280(settings),
+  m_session(session, length),
+  m_mismatches(0),
+  m_timestamp(0)
+{
+}
+
+
+/****************************************************************/
+void BME280Replay::rewind()
+{
+   m_session.rewind();
+   m_timestamp = 0;
+}
+
+
+/****************************************************************/
+bool BME280Replay::finished() const
+{
+   return m_session.end();
+}
+
+
+/****************************************************************/
+uint32_t BME280Replay::mismatches() const
+{
+   return m_mismatches;
+}
+
+
+/****************************************************************/
+uint32_t BME280Replay::timestamp() const
+{
+   return m_timestamp;
+}
+
+
+/****************************************************************/
+bool BME280Replay::WriteRegister
+(
+   uint8_t addr,
+   uint8_t data
+)
+{
+   BME280SessionEntry entry;
+
+   if(!m_session.next(entry)) { return false; }
+
+   if(entry.read || entry.addr != addr || entry.data[0] != data)
+   {
+      ++m_mismatches;
+      return false;
+   }
+
+   m_timestamp = entry.timestamp;
+   return entry.success;
+}
+
+
+/****************************************************************/
+bool BME280Replay::ReadRegister
+(
+   uint8_t addr,
+   uint8_t data[],
+   uint8_t length
+)
+{
+   BME280SessionEntry entry;
+
+   if(!m_session.next(entry)) { return false; }
+
+   if(!entry.read || entry.addr != addr || entry.length != length)
+   {
+      ++m_mismatches;
+      return false;
+   }
+
+   for(uint8_t i = 0; i < length; ++i)
+   {
+      data[i] = entry.data[i];
+   }
+
+   m_timestamp = entry.timestamp;
+   return entry.success;
+}
@@ -0,0 +1,96 @@
+/*
+
+BME280Replay.h
+
+This code replays a recorded BME280 bus session.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This code is licensed under the GNU LGPL and is open for ditrbution
+and copying in accordance with the license.
+This header must be included in any derived code or copies of the code.
+
+ */
+
+#ifndef TG_BME_280_REPLAY_H
+#define TG_BME_280_REPLAY_H
+
+#include "BME280.h"
+#include "BME280Session.h"
+
+//////////////////////////////////////////////////////////////////
+/// BME280Replay - Transport that answers register accesses from a
+/// session recorded with BME280Recorder, so the recorded traffic
+/// runs through the same BME280 code without a sensor. Together
+/// with the Arduino shim in extras/host it runs on a Linux host.
+///
+/// Every access must match the next recorded entry: same direction,
+/// address and length, and for writes the same data. A mismatch
+/// fails the access and is counted, accesses after the end of the
+/// session fail.
+///
+class BME280Replay: public BME280
+{
+public:
+
+   ///////////////////////////////////////////////////////////////
+   /// Constructor used to create the class. The settings must match
+   /// the ones used while recording.
+   BME280Replay(
+      const uint8_t session[],
+      size_t length,
+      const Settings& settings = Settings());
+
+   ///////////////////////////////////////////////////////////////
+   /// Restart the session from the first entry.
+   void rewind();
+
+   ///////////////////////////////////////////////////////////////
+   /// Return true once every recorded entry has been replayed.
+   bool finished() const;
+
+   ///////////////////////////////////////////////////////////////
+   /// Return the number of accesses that did not match the session.
+   uint32_t mismatches() const;
+
+   ///////////////////////////////////////////////////////////////
+   /// Return the recorded time of the last entry replayed [us].
+   uint32_t timestamp() const;
+
+protected:
+
+   ///////////////////////////////////////////////////////////////
+   virtual bool WriteRegister(
+      uint8_t addr,
+      uint8_t data);
+
+   ///////////////////////////////////////////////////////////////
+   virtual bool ReadRegister(
+      uint8_t addr,
+      uint8_t data[],
+      uint8_t length);
+
+private:
+
+   BME280SessionReader m_session;
+   uint32_t m_mismatches;
+   uint32_t m_timestamp;
+};
+
+#endif // TG_BME_280_REPLAY_H
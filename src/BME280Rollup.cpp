@@ -0,0 +1,298 @@
+/*
+BME280Rollup.cpp
+This code keeps downsampled history at several resolutions.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This header must be included in any derived code or copies of the code.
+
+ */
+
+#include "BME280Rollup.h"
+
+static const uint16_t BUCKET_COUNT_MAX = 0xFFFF;
+static const int32_t VALUE_MAX = 32767;
+
+
+/****************************************************************/
+BME280Rollup::BME280Rollup
+(
+   const BME280RollupLevel levels[],
+   uint8_t levelCount,
+   int32_t offset,
+   uint8_t shift
+):m_levels(levels),
+  m_levelCount(levelCount > MAX_LEVELS ? MAX_LEVELS : levelCount),
+  m_offset(offset),
+  m_shift(shift)
+{
+   clear();
+}
+
+
+/****************************************************************/
+void BME280Rollup::clear()
+{
+   for(uint8_t level = 0; level < m_levelCount; ++level)
+   {
+      for(uint16_t i = 0; i < m_levels[level].count; ++i)
+      {
+         m_levels[level].buckets[i].count = 0;
+      }
+      m_open[level].sum = 0;
+      m_open[level].count = 0;
+      m_index[level] = 0;
+   }
+
+   m_started = false;
+   m_time = 0;
+}
+
+
+/****************************************************************/
+bool BME280Rollup::add
+(
+   int32_t value,
+   uint32_t time
+)
+{
+   if(!m_started)
+   {
+      m_started = true;
+      for(uint8_t level = 0; level < m_levelCount; ++level)
+      {
+         m_index[level] = time / m_levels[level].duration;
+      }
+      m_time = time;
+   }
+
+   if(time < m_time) { return false; }
+   m_time = time;
+
+   // Finest first, so a closed bucket is folded into the next level
+   // before that level closes.
+   for(uint8_t level = 0; level < m_levelCount; ++level)
+   {
+      uint32_t index = time / m_levels[level].duration;
+      if(index != m_index[level])
+      {
+         Close(level, index);
+      }
+   }
+
+   // Rounded to the nearest step so the means are not biased.
+   int32_t fixed = (value - m_offset + ((1 << m_shift) >> 1)) >> m_shift;
+   if(fixed > VALUE_MAX) { fixed = VALUE_MAX; }
+   if(fixed < -VALUE_MAX) { fixed = -VALUE_MAX; }
+
+   Merge(m_open[0], fixed, 1, fixed, fixed);
+
+   return true;
+}
+
+
+/****************************************************************/
+void BME280Rollup::Close
+(
+   uint8_t level,
+   uint32_t index
+)
+{
+   const BME280RollupLevel& ring = m_levels[level];
+   Accumulator& open = m_open[level];
+
+   BME280RollupBucket& closed = ring.buckets[m_index[level] % ring.count];
+   closed.count = open.count > BUCKET_COUNT_MAX ? BUCKET_COUNT_MAX : open.count;
+   if(open.count > 0)
+   {
+      int64_t half = open.sum < 0 ? -(int64_t)open.count / 2 : open.count / 2;
+      closed.mean = (open.sum + half) / (int64_t)open.count;
+      closed.min = open.min;
+      closed.max = open.max;
+   }
+
+   // Buckets without values, at most all.
+   for(uint32_t i = m_index[level] + 1; i < index && i <= m_index[level] + ring.count; ++i)
+   {
+      ring.buckets[i % ring.count].count = 0;
+   }
+
+   if(level + 1 < m_levelCount)
+   {
+      Merge(m_open[level + 1], open.sum, open.count, open.min, open.max);
+   }
+
+   open.sum = 0;
+   open.count = 0;
+   m_index[level] = index;
+}
+
+
+/****************************************************************/
+void BME280Rollup::Merge
+(
+   Accumulator& total,
+   int64_t sum,
+   uint32_t count,
+   int16_t min,
+   int16_t max
+)
+{
+   if(count == 0) { return; }
+
+   if(total.count == 0 || min < total.min) { total.min = min; }
+   if(total.count == 0 || max > total.max) { total.max = max; }
+   total.sum += sum;
+   total.count += count;
+}
+
+
+/****************************************************************/
+uint32_t BME280Rollup::Oldest
+(
+   uint8_t level
+) const
+{
+   uint16_t count = m_levels[level].count;
+   return m_index[level] > count ? m_index[level] - count : 0;
+}
+
+
+/****************************************************************/
+void BME280Rollup::Collect
+(
+   uint8_t level,
+   uint32_t index,
+   Accumulator& total
+) const
+{
+   if(index == m_index[level])
+   {
+      // The finer open buckets are not folded in yet.
+      for(uint8_t finer = 0; finer <= level; ++finer)
+      {
+         const Accumulator& open = m_open[finer];
+         Merge(total, open.sum, open.count, open.min, open.max);
+      }
+      return;
+   }
+
+   const BME280RollupLevel& ring = m_levels[level];
+   const BME280RollupBucket& bucket = ring.buckets[index % ring.count];
+   Merge(total, (int64_t)bucket.mean * bucket.count, bucket.count, bucket.min, bucket.max);
+}
+
+
+/****************************************************************/
+bool BME280Rollup::Summarize
+(
+   const Accumulator& total,
+   uint8_t level,
+   uint32_t first,
+   uint32_t last,
+   Summary& summary
+) const
+{
+   uint32_t duration = m_levels[level].duration;
+
+   summary.count = total.count;
+   summary.level = level;
+   summary.from = first * duration;
+   summary.to = (last + 1) * duration;
+   if(total.count == 0) { return false; }
+
+   // Keep the fraction of the fixed point mean.
+   int64_t sum = total.sum * ((int64_t)1 << m_shift);
+   int64_t half = sum < 0 ? -(int64_t)total.count / 2 : total.count / 2;
+   summary.mean = m_offset + (int32_t)((sum + half) / (int64_t)total.count);
+   summary.min = m_offset + (int32_t)total.min * (1 << m_shift);
+   summary.max = m_offset + (int32_t)total.max * (1 << m_shift);
+
+   return true;
+}
+
+
+/****************************************************************/
+bool BME280Rollup::query
+(
+   uint32_t from,
+   uint32_t to,
+   Summary& summary
+) const
+{
+   if(!m_started || m_levelCount == 0 || to <= from) { return false; }
+
+   // The coarsest level whose buckets match the range.
+   int8_t chosen = -1;
+   for(int8_t level = m_levelCount - 1; level >= 0 && chosen < 0; --level)
+   {
+      uint32_t duration = m_levels[level].duration;
+      if(from % duration == 0 && (to % duration == 0 || to > m_time) &&
+         from / duration >= Oldest(level))
+      {
+         chosen = level;
+      }
+   }
+
+   // Else the finest level that still holds from, or the coarsest.
+   for(uint8_t level = 0; level < m_levelCount && chosen < 0; ++level)
+   {
+      if(from / m_levels[level].duration >= Oldest(level))
+      {
+         chosen = level;
+      }
+   }
+   if(chosen < 0) { chosen = m_levelCount - 1; }
+
+   uint32_t duration = m_levels[chosen].duration;
+   uint32_t first = from / duration;
+   uint32_t last = (to - 1) / duration;
+   if(first < Oldest(chosen)) { first = Oldest(chosen); }
+   if(last > m_index[chosen]) { last = m_index[chosen]; }
+
+   Accumulator total = { 0, 0, 0, 0 };
+   for(uint32_t index = first; index <= last && first <= last; ++index)
+   {
+      Collect(chosen, index, total);
+   }
+
+   return Summarize(total, chosen, first, last, summary);
+}
+
+
+/****************************************************************/
+bool BME280Rollup::bucket
+(
+   uint8_t level,
+   uint16_t age,
+   Summary& summary
+) const
+{
+   if(!m_started || level >= m_levelCount || age > m_index[level] ||
+      m_index[level] - age < Oldest(level))
+   {
+      return false;
+   }
+
+   uint32_t index = m_index[level] - age;
+   Accumulator total = { 0, 0, 0, 0 };
+   Collect(level, index, total);
+
+   return Summarize(total, level, index, index, summary);
+}
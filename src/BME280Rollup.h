@@ -0,0 +1,194 @@
+/*
+
+BME280Rollup.h
+
+This code keeps downsampled history at several resolutions.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This code is licensed under the GNU LGPL and is open for ditrbution
+and copying in accordance with the license.
+This header must be included in any derived code or copies of the code.
+
+Each level is a ring of caller provided buckets of one duration, e.g.
+60 of 1 minute, 96 of 15 minutes and 168 of 1 hour. A level's duration
+must be a multiple of the one before. Samples are added to the open
+bucket of the finest level only; when it closes it is stored and
+folded into the open bucket of the next level, so an add takes constant
+time. Values are stored as 16 bit fixed point, (value - offset) >>
+shift, in 8 bytes per bucket.
+
+This file only depends on stdint so it also builds on a host.
+
+ */
+
+#ifndef TG_BME_280_ROLLUP_H
+#define TG_BME_280_ROLLUP_H
+
+#include <stdint.h>
+
+/////////////////////////////////////////////////////////////////
+/// One bucket, values in fixed point.
+struct BME280RollupBucket
+{
+   int16_t mean;
+   int16_t min;
+   int16_t max;
+   uint16_t count;
+};
+
+
+/////////////////////////////////////////////////////////////////
+/// One level, count buckets of duration seconds.
+struct BME280RollupLevel
+{
+   BME280RollupBucket* buckets;
+   uint16_t count;
+   uint32_t duration;
+};
+
+
+//////////////////////////////////////////////////////////////////
+/// BME280Rollup - History of one quantity, e.g. pressure in Pa or
+/// temperature in 0.01 °C, at several resolutions.
+class BME280Rollup
+{
+public:
+
+   static const uint8_t MAX_LEVELS = 4;
+
+   /////////////////////////////////////////////////////////////////
+   /// Summary of a range, values in the units that were added.
+   struct Summary
+   {
+      uint32_t count;         // samples
+      int32_t mean;
+      int32_t min;
+      int32_t max;
+      uint32_t from;          // [s] range covered by the buckets used
+      uint32_t to;
+      uint8_t level;          // that the summary was computed from
+   };
+
+   /////////////////////////////////////////////////////////////////
+   /// Constructor used to create the class. levels are finest first,
+   /// at most MAX_LEVELS, and must outlive the rollup. Values are
+   /// stored as (value - offset) >> shift and clamped to 16 bits,
+   /// e.g. offset 100000 for pressure in Pa, shift 4 for humidity in
+   /// %RH * 1024.
+   BME280Rollup(
+      const BME280RollupLevel levels[],
+      uint8_t levelCount,
+      int32_t offset = 0,
+      uint8_t shift = 0);
+
+   /////////////////////////////////////////////////////////////////
+   /// Add a value measured at time in seconds. Return false and drop
+   /// the value if time is before the last value.
+   bool add(
+      int32_t value,
+      uint32_t time);
+
+   /////////////////////////////////////////////////////////////////
+   /// Forget all values.
+   void clear();
+
+   /////////////////////////////////////////////////////////////////
+   /// Summarize the values from time from up to, not including, to.
+   /// The coarsest level whose buckets start at from and end at to,
+   /// or at the last value, and that still holds from is used. If
+   /// there is none, the finest level holding from is used and the
+   /// range is widened to its buckets. Return false if the range has
+   /// no values.
+   bool query(
+      uint32_t from,
+      uint32_t to,
+      Summary& summary) const;
+
+   /////////////////////////////////////////////////////////////////
+   /// Summarize the bucket age buckets before the open bucket of a
+   /// level, 0 being the open bucket. Return false if it has no
+   /// values or is no longer kept.
+   bool bucket(
+      uint8_t level,
+      uint16_t age,
+      Summary& summary) const;
+
+private:
+
+   /////////////////////////////////////////////////////////////////
+   /// An open bucket.
+   struct Accumulator
+   {
+      int64_t sum;
+      uint32_t count;
+      int16_t min;
+      int16_t max;
+   };
+
+   /////////////////////////////////////////////////////////////////
+   /// Add samples to an accumulator.
+   static void Merge(
+      Accumulator& total,
+      int64_t sum,
+      uint32_t count,
+      int16_t min,
+      int16_t max);
+
+   /////////////////////////////////////////////////////////////////
+   /// Store the open bucket of a level, fold it into the next level
+   /// and open the bucket index.
+   void Close(
+      uint8_t level,
+      uint32_t index);
+
+   /////////////////////////////////////////////////////////////////
+   /// Add the bucket index of a level to an accumulator, the open
+   /// bucket including the open buckets of the finer levels.
+   void Collect(
+      uint8_t level,
+      uint32_t index,
+      Accumulator& total) const;
+
+   /////////////////////////////////////////////////////////////////
+   /// Return the oldest bucket index a level still holds.
+   uint32_t Oldest(
+      uint8_t level) const;
+
+   /////////////////////////////////////////////////////////////////
+   /// Fill a summary from an accumulator, return false if empty.
+   bool Summarize(
+      const Accumulator& total,
+      uint8_t level,
+      uint32_t first,
+      uint32_t last,
+      Summary& summary) const;
+
+   const BME280RollupLevel* m_levels;
+   uint8_t m_levelCount;
+   int32_t m_offset;
+   uint8_t m_shift;
+
+   bool m_started;
+   uint32_t m_time;                    // of the last value
+   uint32_t m_index[MAX_LEVELS];       // open bucket, time / duration
+   Accumulator m_open[MAX_LEVELS];
+};
+
+#endif // TG_BME_280_ROLLUP_H
@@ -0,0 +1,232 @@
+/*
+BME280Session.cpp
+This code records and reads back BME280 bus sessions.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This header must be included in any derived code or copies of the code.
+
+ */
+
+#include "BME280Session.h"
+
+#include <string.h>
+
+static const uint8_t TAG_READ    = 0x01;
+static const uint8_t TAG_SUCCESS = 0x02;
+
+
+/****************************************************************/
+BME280SessionWriter::BME280SessionWriter
+(
+   uint8_t buffer[],
+   size_t size
+):m_buffer(buffer),
+  m_size(size)
+{
+   clear();
+}
+
+
+/****************************************************************/
+void BME280SessionWriter::clear()
+{
+   m_length = 0;
+   m_started = false;
+   m_overflow = false;
+   m_lastTimestamp = 0;
+}
+
+
+/****************************************************************/
+void BME280SessionWriter::write
+(
+   uint8_t addr,
+   uint8_t data,
+   bool success,
+   uint32_t timestamp
+)
+{
+   Append(false, addr, &data, 1, success, timestamp);
+}
+
+
+/****************************************************************/
+void BME280SessionWriter::read
+(
+   uint8_t addr,
+   const uint8_t data[],
+   uint8_t length,
+   bool success,
+   uint32_t timestamp
+)
+{
+   Append(true, addr, data, length, success, timestamp);
+}
+
+
+/****************************************************************/
+bool BME280SessionWriter::Append
+(
+   bool read,
+   uint8_t addr,
+   const uint8_t data[],
+   uint8_t length,
+   bool success,
+   uint32_t timestamp
+)
+{
+   uint8_t header[8];
+   uint8_t headerLength = 0;
+
+   if(!m_started)
+   {
+      m_started = true;
+      m_lastTimestamp = timestamp;
+   }
+
+   // Unsigned wrap around keeps deltas valid across a timer overflow.
+   uint32_t delta = timestamp - m_lastTimestamp;
+
+   header[headerLength++] = (read ? TAG_READ : 0) | (success ? TAG_SUCCESS : 0);
+   while(delta >= 0x80)
+   {
+      header[headerLength++] = (delta & 0x7F) | 0x80;
+      delta >>= 7;
+   }
+   header[headerLength++] = delta;
+   header[headerLength++] = addr;
+   if(read)
+   {
+      header[headerLength++] = length;
+   }
+
+   if(m_overflow || m_size - m_length < (size_t)headerLength + length)
+   {
+      m_overflow = true;
+      return false;
+   }
+
+   memcpy(&m_buffer[m_length], header, headerLength);
+   m_length += headerLength;
+   memcpy(&m_buffer[m_length], data, length);
+   m_length += length;
+
+   m_lastTimestamp = timestamp;
+
+   return true;
+}
+
+
+/****************************************************************/
+const uint8_t* BME280SessionWriter::data() const
+{
+   return m_buffer;
+}
+
+
+/****************************************************************/
+size_t BME280SessionWriter::length() const
+{
+   return m_length;
+}
+
+
+/****************************************************************/
+bool BME280SessionWriter::overflow() const
+{
+   return m_overflow;
+}
+
+
+/****************************************************************/
+BME280SessionReader::BME280SessionReader
+(
+   const uint8_t session[],
+   size_t length
+):m_session(session),
+  m_length(length)
+{
+   rewind();
+}
+
+
+/****************************************************************/
+void BME280SessionReader::rewind()
+{
+   m_ord = 0;
+   m_timestamp = 0;
+}
+
+
+/****************************************************************/
+bool BME280SessionReader::end() const
+{
+   return m_ord >= m_length;
+}
+
+
+/****************************************************************/
+bool BME280SessionReader::next
+(
+   BME280SessionEntry& entry
+)
+{
+   size_t ord = m_ord;
+   uint32_t delta = 0;
+   uint8_t shift = 0;
+
+   // A truncated entry ends the session.
+   m_ord = m_length;
+
+   if(ord >= m_length) { return false; }
+   uint8_t tag = m_session[ord++];
+
+   do
+   {
+      if(ord >= m_length || shift > 28) { return false; }
+      delta |= (uint32_t)(m_session[ord] & 0x7F) << shift;
+      shift += 7;
+   } while(m_session[ord++] & 0x80);
+
+   if(ord >= m_length) { return false; }
+   entry.addr = m_session[ord++];
+
+   entry.read = tag & TAG_READ;
+   entry.success = tag & TAG_SUCCESS;
+   if(entry.read)
+   {
+      if(ord >= m_length) { return false; }
+      entry.length = m_session[ord++];
+   }
+   else
+   {
+      entry.length = 1;
+   }
+
+   if(m_length - ord < entry.length) { return false; }
+   entry.data = &m_session[ord];
+   ord += entry.length;
+
+   m_timestamp += delta;
+   entry.timestamp = m_timestamp;
+   m_ord = ord;
+
+   return true;
+}
@@ -0,0 +1,158 @@
+/*
+
+BME280Session.h
+
+This code records and reads back BME280 bus sessions.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This code is licensed under the GNU LGPL and is open for ditrbution
+and copying in accordance with the license.
+This header must be included in any derived code or copies of the code.
+
+A session is the sequence of WriteRegister and ReadRegister calls
+made by a BME280, see BME280Recorder.h and BME280Replay.h.
+
+Entry layout:
+
+   0   tag, bit 0 set for a read, bit 1 set if the call succeeded
+   1   time since the previous entry in microseconds, unsigned
+       LEB128 varint
+   n   register address
+       write: the data byte
+       read:  the length, then length data bytes
+
+This file only depends on stdint so the same code reads sessions on
+the target and on a host.
+
+ */
+
+#ifndef TG_BME_280_SESSION_H
+#define TG_BME_280_SESSION_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/////////////////////////////////////////////////////////////////
+/// One recorded register access.
+struct BME280SessionEntry
+{
+   bool read;
+   bool success;
+   uint32_t timestamp;        // [us] since the start of the session
+   uint8_t addr;
+   uint8_t length;
+   const uint8_t* data;       // points into the session buffer
+};
+
+
+//////////////////////////////////////////////////////////////////
+/// BME280SessionWriter - Appends entries to a caller provided
+/// buffer. Entries that do not fit are dropped and flagged.
+class BME280SessionWriter
+{
+public:
+
+   BME280SessionWriter(
+      uint8_t buffer[],
+      size_t size);
+
+   /////////////////////////////////////////////////////////////////
+   /// Append a register write made at timestamp [us].
+   void write(
+      uint8_t addr,
+      uint8_t data,
+      bool success,
+      uint32_t timestamp);
+
+   /////////////////////////////////////////////////////////////////
+   /// Append a register read made at timestamp [us].
+   void read(
+      uint8_t addr,
+      const uint8_t data[],
+      uint8_t length,
+      bool success,
+      uint32_t timestamp);
+
+   /////////////////////////////////////////////////////////////////
+   /// Return the recorded session and its length in bytes.
+   const uint8_t* data() const;
+   size_t length() const;
+
+   /////////////////////////////////////////////////////////////////
+   /// Return true if entries were dropped because the buffer was
+   /// full.
+   bool overflow() const;
+
+   /////////////////////////////////////////////////////////////////
+   /// Start a new session in the same buffer.
+   void clear();
+
+private:
+
+   bool Append(
+      bool read,
+      uint8_t addr,
+      const uint8_t data[],
+      uint8_t length,
+      bool success,
+      uint32_t timestamp);
+
+   uint8_t* m_buffer;
+   size_t m_size;
+   size_t m_length;
+   bool m_started;
+   bool m_overflow;
+   uint32_t m_lastTimestamp;
+};
+
+
+//////////////////////////////////////////////////////////////////
+/// BME280SessionReader - Iterates over the entries of a session.
+class BME280SessionReader
+{
+public:
+
+   BME280SessionReader(
+      const uint8_t session[],
+      size_t length);
+
+   /////////////////////////////////////////////////////////////////
+   /// Decode the next entry, return false at the end of the session
+   /// or if the rest of it is truncated.
+   bool next(
+      BME280SessionEntry& entry);
+
+   /////////////////////////////////////////////////////////////////
+   /// Return true once every entry has been read.
+   bool end() const;
+
+   /////////////////////////////////////////////////////////////////
+   /// Go back to the first entry.
+   void rewind();
+
+private:
+
+   const uint8_t* m_session;
+   size_t m_length;
+   size_t m_ord;
+   uint32_t m_timestamp;
+};
+
+#endif // TG_BME_280_SESSION_H
@@ -45,12 +45,10 @@ BME280Spi::BME280Spi
 
 
 /****************************************************************/
-bool BME280Spi::Initialize()
+void BME280Spi::InitializeInterface()
 {
    pinMode(m_settings.spiCsPin, OUTPUT);
    digitalWrite(m_settings.spiCsPin, HIGH);
-
-   return BME280::Initialize();
 }
 
 /****************************************************************/
@@ -132,3 +130,31 @@ bool BME280Spi::WriteRegister
 
    return true;
 }
+
+
+/****************************************************************/
+bool BME280Spi::WriteRegisters
+(
+   const uint8_t pairs[],
+   uint8_t count
+)
+{
+   SPI.beginTransaction(SPISettings(500000,MSBFIRST,SPI_MODE0));
+
+   // select the device
+   digitalWrite(m_settings.spiCsPin, LOW);
+
+   // transfer each addr, with the write bit cleared, and its data
+   for(int i = 0; i < count; ++i)
+   {
+      SPI.transfer(pairs[2 * i] & ~0x80);
+      SPI.transfer(pairs[2 * i + 1]);
+   }
+
+   // de-select the device
+   digitalWrite(m_settings.spiCsPin, HIGH);
+
+   SPI.endTransaction();
+
+   return true;
+}
@@ -75,16 +75,8 @@ public:
 protected:
 
    ////////////////////////////////////////////////////////////////
-   /// Method used at start up to initialize the class. Starts the
-   /// I2C interface.
-   virtual bool Initialize();
-
-private:
-
-   static const uint8_t BME280_SPI_WRITE   = 0x7F;
-   static const uint8_t BME280_SPI_READ    = 0x80;
-
-   Settings m_settings;
+   /// Method used at start up to set up the chip select pin.
+   virtual void InitializeInterface();
 
    ////////////////////////////////////////////////////////////////
    /// Read the data from the BME280 addr into an array and
@@ -100,5 +92,18 @@ private:
       uint8_t addr,
       uint8_t data);
 
+   ////////////////////////////////////////////////////////////////
+   /// Write several BME280 registers in one transaction.
+   virtual bool WriteRegisters(
+      const uint8_t pairs[],
+      uint8_t count);
+
+private:
+
+   static const uint8_t BME280_SPI_WRITE   = 0x7F;
+   static const uint8_t BME280_SPI_READ    = 0x80;
+
+   Settings m_settings;
+
 };
 #endif // TG_BME_280_SPI_H
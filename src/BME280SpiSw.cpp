@@ -45,7 +45,7 @@ BME280SpiSw::BME280SpiSw
 
 
 /****************************************************************/
-bool BME280SpiSw::Initialize(){
+void BME280SpiSw::InitializeInterface(){
 
    digitalWrite(m_settings.spiCsPin, HIGH);
    pinMode(m_settings.spiCsPin, OUTPUT);
@@ -53,8 +53,6 @@ bool BME280SpiSw::Initialize(){
    pinMode(m_settings.spiSckPin, OUTPUT);
    pinMode(m_settings.spiMosiPin, OUTPUT);
    pinMode(m_settings.spiMisoPin, INPUT);
-
-   return BME280::Initialize();
 }
 
 
@@ -150,3 +148,26 @@ bool BME280SpiSw::WriteRegister
 return true;
 }
 
+
+/****************************************************************/
+bool BME280SpiSw::WriteRegisters
+(
+   const uint8_t pairs[],
+   uint8_t count
+)
+{
+   // select the device
+   digitalWrite(m_settings.spiCsPin, LOW);
+
+   // transfer each addr, with the write bit cleared, and its data
+   for(int i = 0; i < count; ++i)
+   {
+      SpiTransferSw(pairs[2 * i] & ~0x80);
+      SpiTransferSw(pairs[2 * i + 1]);
+   }
+
+   // de-select the device
+   digitalWrite(m_settings.spiCsPin, HIGH);
+
+   return true;
+}
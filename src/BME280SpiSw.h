@@ -81,21 +81,8 @@ class BME280SpiSw: public BME280{
 protected:
 
    ////////////////////////////////////////////////////////////////
-   /// Method used at start up to initialize the class. Starts the
-   /// software SPI interface.
-   virtual bool Initialize();
-
-private:
-
-   static const uint8_t BME280_SPI_WRITE = 0x7F;
-   static const uint8_t BME280_SPI_READ = 0x80;
-
-   Settings m_settings;
-
-   ////////////////////////////////////////////////////////////////
-   /// Does a sw spi transfer.
-   uint8_t SpiTransferSw(
-      uint8_t data);
+   /// Method used at start up to set up the software SPI pins.
+   virtual void InitializeInterface();
 
    ////////////////////////////////////////////////////////////////
    /// Read the data from the BME280 addr into an array and return
@@ -111,5 +98,23 @@ private:
       uint8_t addr,
       uint8_t data);
 
+   ////////////////////////////////////////////////////////////////
+   /// Write several BME280 registers in one transaction.
+   virtual bool WriteRegisters(
+      const uint8_t pairs[],
+      uint8_t count);
+
+private:
+
+   static const uint8_t BME280_SPI_WRITE = 0x7F;
+   static const uint8_t BME280_SPI_READ = 0x80;
+
+   Settings m_settings;
+
+   ////////////////////////////////////////////////////////////////
+   /// Does a sw spi transfer.
+   uint8_t SpiTransferSw(
+      uint8_t data);
+
 };
 #endif // TG_BME_280_SPI_H
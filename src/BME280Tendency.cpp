@@ -0,0 +1,258 @@
+/*
+BME280Tendency.cpp
+This code tracks pressure tendency over a sliding window.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This header must be included in any derived code or copies of the code.
+
+ */
+
+#include "BME280Tendency.h"
+
+static const uint16_t BUCKET_COUNT_MAX = 0xFFFF;
+static const int32_t DELTA_MAX = 32767;
+static const uint32_t SECONDS_PER_HOUR = 3600;
+
+
+/****************************************************************/
+static int8_t Sign
+(
+   float change,
+   int32_t steady
+)
+{
+   return change > steady ? 1 : change < -steady ? -1 : 0;
+}
+
+
+/****************************************************************/
+BME280Tendency::BME280Tendency
+(
+   BME280TendencyBucket buckets[],
+   uint8_t count,
+   uint32_t bucketDuration
+):m_buckets(buckets),
+  m_count(count),
+  m_bucketDuration(bucketDuration)
+{
+   if(m_bucketDuration < 1) { m_bucketDuration = 1; }
+   clear();
+}
+
+
+/****************************************************************/
+void BME280Tendency::clear()
+{
+   for(uint8_t i = 0; i < m_count; ++i)
+   {
+      m_buckets[i].count = 0;
+      m_buckets[i].sum = 0;
+   }
+
+   m_started = false;
+   m_base = 0;
+   m_current = 0;
+   m_time = 0;
+}
+
+
+/****************************************************************/
+bool BME280Tendency::add
+(
+   uint32_t pressure,
+   uint32_t time
+)
+{
+   if(m_count == 0) { return false; }
+
+   if(!m_started)
+   {
+      m_started = true;
+      m_base = pressure;
+      m_current = time / m_bucketDuration;
+      m_time = time;
+   }
+
+   if(time < m_time) { return false; }
+
+   // Empty the buckets that fell out of the window, at most all.
+   uint32_t index = time / m_bucketDuration;
+   for(uint32_t i = m_current + 1; i <= index && i <= m_current + m_count; ++i)
+   {
+      m_buckets[i % m_count].count = 0;
+      m_buckets[i % m_count].sum = 0;
+   }
+   m_current = index;
+   m_time = time;
+
+   BME280TendencyBucket& bucket = m_buckets[index % m_count];
+   if(bucket.count == BUCKET_COUNT_MAX) { return true; }
+
+   int32_t delta = (int32_t)(pressure - m_base);
+   if(delta > DELTA_MAX) { delta = DELTA_MAX; }
+   if(delta < -DELTA_MAX) { delta = -DELTA_MAX; }
+
+   if(bucket.count == 0)
+   {
+      bucket.min = delta;
+      bucket.max = delta;
+   }
+   else
+   {
+      if(delta < bucket.min) { bucket.min = delta; }
+      if(delta > bucket.max) { bucket.max = delta; }
+   }
+   bucket.sum += delta;
+   ++bucket.count;
+
+   return true;
+}
+
+
+/****************************************************************/
+const BME280TendencyBucket& BME280Tendency::Bucket
+(
+   uint8_t age
+) const
+{
+   return m_buckets[(m_current % m_count + m_count - age) % m_count];
+}
+
+
+/****************************************************************/
+uint8_t BME280Tendency::Fit
+(
+   uint8_t newest,
+   uint8_t oldest,
+   Stats& stats,
+   float& slope
+) const
+{
+   // Sums over the samples, x being minus the bucket age.
+   int64_t w = 0, sx = 0, sy = 0, sxx = 0, sxy = 0;
+   int16_t low = 0, high = 0;
+   uint8_t buckets = 0, oldestUsed = 0;
+
+   for(uint16_t age = newest; age <= oldest; ++age)
+   {
+      const BME280TendencyBucket& bucket = Bucket(age);
+      if(bucket.count == 0) { continue; }
+
+      int32_t x = -(int32_t)age;
+      w += bucket.count;
+      sx += (int64_t)bucket.count * x;
+      sy += bucket.sum;
+      sxx += (int64_t)bucket.count * x * x;
+      sxy += (int64_t)bucket.sum * x;
+
+      if(buckets == 0 || bucket.min < low) { low = bucket.min; }
+      if(buckets == 0 || bucket.max > high) { high = bucket.max; }
+      oldestUsed = age;
+      ++buckets;
+   }
+
+   slope = 0;
+   stats.count = w;
+   stats.slope = 0;
+   stats.span = 0;
+   if(buckets == 0) { return 0; }
+
+   int64_t half = sy < 0 ? -w / 2 : w / 2;
+   stats.mean = m_base + (int32_t)((sy + half) / w);
+   stats.min = m_base + low;
+   stats.max = m_base + high;
+   stats.span = m_time - (m_current - oldestUsed) * m_bucketDuration;
+
+   if(buckets >= 2)
+   {
+      slope = (float)(w * sxy - sx * sy) / (float)(w * sxx - sx * sx);
+      float perHour = slope * SECONDS_PER_HOUR / m_bucketDuration;
+      stats.slope = (int32_t)(perHour < 0 ? perHour - 0.5f : perHour + 0.5f);
+   }
+
+   return buckets;
+}
+
+
+/****************************************************************/
+bool BME280Tendency::stats
+(
+   Stats& stats
+) const
+{
+   float slope;
+   return m_started && Fit(0, m_count - 1, stats, slope) > 0;
+}
+
+
+/****************************************************************/
+bool BME280Tendency::tendency
+(
+   int32_t& change,
+   uint8_t& characteristic,
+   int32_t steady
+) const
+{
+   Stats stats;
+   float newerSlope, olderSlope;
+   uint8_t half = m_count / 2;
+
+   if(!m_started || m_count < 4 ||
+      Fit(0, half - 1, stats, newerSlope) < 2 ||
+      Fit(half, m_count - 1, stats, olderSlope) < 2)
+   {
+      return false;
+   }
+
+   // Change in the older and the newer half of the window.
+   float first = olderSlope * (m_count - half);
+   float second = newerSlope * half;
+   float total = first + second;
+   change = (int32_t)(total < 0 ? total - 0.5f : total + 0.5f);
+
+   int8_t net = Sign(total, steady);
+   int8_t rise1 = Sign(first, steady);
+   int8_t rise2 = Sign(second, steady);
+
+   if(net == 0)
+   {
+      characteristic = rise1 > 0 && rise2 < 0 ? 0 : rise1 < 0 && rise2 > 0 ? 5 : 4;
+   }
+   else if(net > 0)
+   {
+      if(rise1 > 0 && rise2 < 0)          { characteristic = 0; }
+      else if(rise1 <= 0)                 { characteristic = 3; }
+      else if(rise2 == 0)                 { characteristic = 1; }
+      else if(second < first - steady)    { characteristic = 1; }
+      else if(second > first + steady)    { characteristic = 3; }
+      else                                { characteristic = 2; }
+   }
+   else
+   {
+      if(rise1 < 0 && rise2 > 0)          { characteristic = 5; }
+      else if(rise1 >= 0)                 { characteristic = 8; }
+      else if(rise2 == 0)                 { characteristic = 6; }
+      else if(second > first + steady)    { characteristic = 6; }
+      else if(second < first - steady)    { characteristic = 8; }
+      else                                { characteristic = 7; }
+   }
+
+   return true;
+}
@@ -0,0 +1,162 @@
+/*
+
+BME280Tendency.h
+
+This code tracks pressure tendency over a sliding window.
+This file is part of the Arduino BME280 library.
+Copyright (C) 2016  Tyler Glenn
+
+This program is free software: you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation, either version 3 of the License, or
+(at your option) any later version.
+
+This program is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+Written: Oct 19 2026.
+Last Updated: Oct 19 2026.
+
+This code is licensed under the GNU LGPL and is open for ditrbution
+and copying in accordance with the license.
+This header must be included in any derived code or copies of the code.
+
+The window is a ring of caller provided buckets of equal duration.
+Each bucket keeps the count, sum, minimum and maximum of its samples,
+so adding a sample takes constant time and the memory does not grow
+with the sample rate. Statistics are computed over the buckets, the
+slope by least squares on the bucket means weighted by their counts.
+Use one instance per horizon, e.g. 12 buckets of 15 minutes for the
+3 hour tendency and 10 buckets of 1 minute for the short term rate.
+
+This file only depends on stdint so it also builds on a host.
+
+ */
+
+#ifndef TG_BME_280_TENDENCY_H
+#define TG_BME_280_TENDENCY_H
+
+#include <stdint.h>
+
+/////////////////////////////////////////////////////////////////
+/// Samples of one bucket, pressures in Pa relative to the first
+/// sample added.
+struct BME280TendencyBucket
+{
+   int32_t sum;
+   uint16_t count;
+   int16_t min;
+   int16_t max;
+};
+
+
+//////////////////////////////////////////////////////////////////
+/// BME280Tendency - Pressure statistics over a sliding window and
+/// the WMO pressure tendency characteristic.
+class BME280Tendency
+{
+public:
+
+   /////////////////////////////////////////////////////////////////
+   /// Statistics of the window, pressures in Pa.
+   struct Stats
+   {
+      uint32_t count;         // samples
+      uint32_t mean;
+      uint32_t min;
+      uint32_t max;
+      int32_t slope;          // Pa per hour, 0 with less than 2 buckets
+      uint32_t span;          // seconds from the oldest bucket to now
+   };
+
+   /////////////////////////////////////////////////////////////////
+   /// Pressure change of the last 3 hours, below this is steady [Pa].
+   static const int32_t STEADY = 10;
+
+   /////////////////////////////////////////////////////////////////
+   /// Constructor used to create the class. The window covers count
+   /// buckets of bucketDuration seconds. Samples need at least 1
+   /// bucket and tendency() at least 4, a bucketDuration of 0 is
+   /// taken as 1.
+   BME280Tendency(
+      BME280TendencyBucket buckets[],
+      uint8_t count,
+      uint32_t bucketDuration);
+
+   /////////////////////////////////////////////////////////////////
+   /// Add a pressure in Pa, e.g. from BME280::read(uint32_t&,
+   /// int32_t&, uint32_t&), measured at time in seconds. Return false
+   /// and drop the sample if time is before the last sample or there
+   /// are no buckets.
+   bool add(
+      uint32_t pressure,
+      uint32_t time);
+
+   /////////////////////////////////////////////////////////////////
+   /// Forget all samples.
+   void clear();
+
+   /////////////////////////////////////////////////////////////////
+   /// Compute the statistics of the window, return false if it has
+   /// no samples.
+   bool stats(
+      Stats& stats) const;
+
+   /////////////////////////////////////////////////////////////////
+   /// Compute the pressure change over the window in Pa and the WMO
+   /// pressure tendency characteristic, code table 0200:
+   ///
+   ///   0  increasing, then decreasing; same or higher
+   ///   1  increasing, then steady or increasing more slowly; higher
+   ///   2  increasing steadily or unsteadily; higher
+   ///   3  decreasing or steady then increasing, or increasing more
+   ///      rapidly; higher
+   ///   4  steady; same
+   ///   5  decreasing, then increasing; same or lower
+   ///   6  decreasing, then steady or decreasing more slowly; lower
+   ///   7  decreasing steadily or unsteadily; lower
+   ///   8  steady or increasing then decreasing, or decreasing more
+   ///      rapidly; lower
+   ///
+   /// The window is meant to be 3 hours. The change in each half is
+   /// fitted separately, changes below steady count as none. Return
+   /// false unless both halves have at least 2 buckets with samples,
+   /// so always with less than 4 buckets.
+   bool tendency(
+      int32_t& change,
+      uint8_t& characteristic,
+      int32_t steady = STEADY) const;
+
+private:
+
+   /////////////////////////////////////////////////////////////////
+   /// Statistics of buckets newest to oldest, 0 being the current
+   /// bucket, and the least squares slope in Pa per bucket. Return
+   /// the number of buckets with samples.
+   uint8_t Fit(
+      uint8_t newest,
+      uint8_t oldest,
+      Stats& stats,
+      float& slope) const;
+
+   /////////////////////////////////////////////////////////////////
+   /// Return the bucket age buckets before the current one.
+   const BME280TendencyBucket& Bucket(
+      uint8_t age) const;
+
+   BME280TendencyBucket* m_buckets;
+   uint8_t m_count;
+   uint32_t m_bucketDuration;
+
+   bool m_started;
+   uint32_t m_base;           // [Pa] first sample, pressures are relative to it
+   uint32_t m_current;        // index of the current bucket, time / duration
+   uint32_t m_time;           // of the last sample
+};
+
+#endif // TG_BME_280_TENDENCY_H
@@ -24,8 +24,8 @@ This header must be included in any derived code or copies of the code.
  */
 #include "EnvironmentCalculations.h"
 
-#include <Arduino.h>
 #include <math.h>
+#include <string.h>
 
 #define hi_coeff1 -42.379
 #define hi_coeff2   2.04901523
@@ -36,6 +36,120 @@ This header must be included in any derived code or copies of the code.
 #define hi_coeff7   0.00122874
 #define hi_coeff8   0.00085282
 #define hi_coeff9  -0.00000199
+
+#define LN2      0.69314718f
+#define LOG2E    1.44269504f
+#define SQRT2    1.41421356f
+
+
+/****************************************************************/
+// Transcendental functions used by the calculations. Defining
+// ENVIRONMENT_CALCULATIONS_FAST_MATH replaces libm with the
+// polynomial approximations below. Altitude, AbsoluteHumidity,
+// EquivalentSeaLevelPressure and DewPoint otherwise keep their
+// original double precision libm calls, so their results don't
+// change on targets with a 64-bit double.
+#ifdef ENVIRONMENT_CALCULATIONS_FAST_MATH
+static inline float Log(float x) { return EnvironmentCalculations::FastLog(x); }
+static inline float Exp(float x) { return EnvironmentCalculations::FastExp(x); }
+static inline float Pow(float x, float y) { return EnvironmentCalculations::FastPow(x, y); }
+static inline double LogDouble(double x) { return EnvironmentCalculations::FastLog(x); }
+static inline double ExpDouble(double x) { return EnvironmentCalculations::FastExp(x); }
+static inline double PowDouble(double x, double y) { return EnvironmentCalculations::FastPow(x, y); }
+#else
+static inline float Log(float x) { return logf(x); }
+static inline float Exp(float x) { return expf(x); }
+static inline float Pow(float x, float y) { return powf(x, y); }
+static inline double LogDouble(double x) { return log(x); }
+static inline double ExpDouble(double x) { return pow(2.718281828, x); }
+static inline double PowDouble(double x, double y) { return pow(x, y); }
+#endif
+
+
+/****************************************************************/
+float EnvironmentCalculations::FastLog
+(
+  float x
+)
+{
+  if (isnan(x) || isinf(x) || x < 0) { return x < 0 ? NAN : x; }
+  if (x == 0) { return -INFINITY; }
+
+  // Split x = 2^e * m with m in [sqrt(0.5), sqrt(2)), then
+  // ln(x) = e * ln(2) + ln(1 + t) with t = m - 1.
+  uint32_t bits;
+  memcpy(&bits, &x, sizeof(bits));
+  int32_t e = (int32_t)(bits >> 23) - 127;
+  if (e == -127)
+  {
+    // Subnormal, normalize first.
+    x *= 8388608.0f;
+    memcpy(&bits, &x, sizeof(bits));
+    e = (int32_t)(bits >> 23) - 150;
+  }
+  bits = (bits & 0x007FFFFF) | 0x3F800000;
+  float m;
+  memcpy(&m, &bits, sizeof(m));
+  if (m > SQRT2)
+  {
+    m *= 0.5f;
+    ++e;
+  }
+  float t = m - 1.0f;
+
+  // ln(1 + t) / t, Chebyshev fit of degree 4 on [sqrt(0.5) - 1, sqrt(2) - 1].
+  float q = 0.173486315f;
+  q = q * t - 0.270102283f;
+  q = q * t + 0.336687816f;
+  q = q * t - 0.499502109f;
+  q = q * t + 0.999962170f;
+
+  return e * LN2 + t * q;
+}
+
+
+/****************************************************************/
+float EnvironmentCalculations::FastExp
+(
+  float x
+)
+{
+  if (isnan(x)) { return x; }
+  if (x > 88.0f) { return INFINITY; }
+  if (x < -86.6f) { return 0.0f; }
+
+  // exp(x) = 2^n * 2^f with n = round(x * log2(e)) and f in [-0.5, 0.5].
+  float y = x * LOG2E;
+  int32_t n = (int32_t)(y < 0 ? y - 0.5f : y + 0.5f);
+  float f = y - n;
+
+  // 2^f, Chebyshev fit of degree 4 on [-0.5, 0.5].
+  float p = 0.00966636852f;
+  p = p * f + 0.0559219758f;
+  p = p * f + 0.240223490f;
+  p = p * f + 0.693121045f;
+  p = p * f + 1.0f;
+
+  // Scale by 2^n through the exponent field.
+  uint32_t bits;
+  memcpy(&bits, &p, sizeof(bits));
+  bits += (uint32_t)n << 23;
+  memcpy(&p, &bits, sizeof(p));
+  return p;
+}
+
+
+/****************************************************************/
+float EnvironmentCalculations::FastPow
+(
+  float x,
+  float y
+)
+{
+  return FastExp(y * FastLog(x));
+}
+
+
 /****************************************************************/
 float EnvironmentCalculations::Altitude
 (
@@ -53,7 +167,7 @@ float EnvironmentCalculations::Altitude
       if(tempUnit != TempUnit_Celsius)
           outdoorTemp = (outdoorTemp - 32.0) * (5.0 / 9.0); /*conversion to [°C]*/
 
-      altitude = pow(referencePressure / pressure, 0.190234) - 1;
+      altitude = PowDouble(referencePressure / pressure, 0.190234) - 1;
       altitude *= ((outdoorTemp + 273.15) / 0.0065);
       if(altUnit != AltitudeUnit_Meters)  altitude *= 3.28084;
   }
@@ -88,7 +202,7 @@ float EnvironmentCalculations::AbsoluteHumidity
         temperature = (temperature - 32.0) * (5.0 / 9.0); /*conversion to [°C]*/
   }
           
-  temp = pow(2.718281828, (17.67 * temperature) / (temperature + 243.5));
+  temp = ExpDouble((17.67 * temperature) / (temperature + 243.5));
   
   //return (6.112 * temp * humidity * 2.1674) / (273.15 + temperature); 	//simplified version
   return (6.112 * temp * humidity * mw) / ((273.15 + temperature) * r); 	//long version
@@ -96,25 +210,15 @@ float EnvironmentCalculations::AbsoluteHumidity
 
 
 /****************************************************************/
-//FYI: https://ehp.niehs.nih.gov/1206273/ in detail this flow graph: https://ehp.niehs.nih.gov/wp-content/uploads/2013/10/ehp.1206273.g003.png
-float EnvironmentCalculations::HeatIndex
+// Heat index in [°F] from a temperature in [°F] and relative humidity.
+static float HeatIndexFahrenheit
 (
   float temperature,
-  float humidity,
-  TempUnit tempUnit
+  float humidity
 )
 {
-  float heatIndex(NAN);
-
-  if ( isnan(temperature) || isnan(humidity) ) 
-  {
-    return heatIndex;
-  }
+  float heatIndex;
 
-  if (tempUnit == TempUnit_Celsius) 
-  {
-    temperature = (temperature * (9.0 / 5.0) + 32.0); /*conversion to [°F]*/
-  }
   // Using both Rothfusz and Steadman's equations
   // http://www.wpc.ncep.noaa.gov/html/heatindex_equation.shtml
   if (temperature <= 40) 
@@ -139,7 +243,7 @@ float EnvironmentCalculations::HeatIndex
       //third red block
       if ((humidity < 13) && (temperature >= 80.0) && (temperature <= 112.0))
       {
-        heatIndex -= ((13.0 - humidity) * 0.25) * sqrt((17.0 - abs(temperature - 95.0)) * 0.05882);
+        heatIndex -= ((13.0 - humidity) * 0.25) * sqrt((17.0 - fabs(temperature - 95.0)) * 0.05882);
       } //fourth red block
       else if ((humidity > 85.0) && (temperature >= 80.0) && (temperature <= 87.0))
       {
@@ -148,14 +252,31 @@ float EnvironmentCalculations::HeatIndex
     }
   }
 
-  if (tempUnit == TempUnit_Celsius) 
+  return heatIndex; //fifth red block
+}
+
+
+/****************************************************************/
+//FYI: https://ehp.niehs.nih.gov/1206273/ in detail this flow graph: https://ehp.niehs.nih.gov/wp-content/uploads/2013/10/ehp.1206273.g003.png
+float EnvironmentCalculations::HeatIndex
+(
+  float temperature,
+  float humidity,
+  TempUnit tempUnit
+)
+{
+  if ( isnan(temperature) || isnan(humidity) ) 
   {
-    return (heatIndex - 32.0) * (5.0 / 9.0); /*conversion back to [°C]*/
+    return NAN;
   }
-  else 
+
+  if (tempUnit == TempUnit_Celsius) 
   {
-    return heatIndex; //fifth red block
+    temperature = (temperature * (9.0 / 5.0) + 32.0); /*conversion to [°F]*/
+    return (HeatIndexFahrenheit(temperature, humidity) - 32.0) * (5.0 / 9.0); /*conversion back to [°C]*/
   }
+
+  return HeatIndexFahrenheit(temperature, humidity);
 }
 
 
@@ -178,7 +299,7 @@ float EnvironmentCalculations::EquivalentSeaLevelPressure
         if(altUnit != AltitudeUnit_Meters)
             altitude *= 0.3048; /*conversion to meters*/
 
-        seaPress = (pres / pow(1 - ((0.0065 *altitude) / (temp + (0.0065 *altitude) + 273.15)), 5.257));
+        seaPress = (pres / PowDouble(1 - ((0.0065 *altitude) / (temp + (0.0065 *altitude) + 273.15)), 5.257));
     }
     return seaPress;
 }
@@ -197,21 +318,558 @@ float EnvironmentCalculations::DewPoint
 
   if(!isnan(temp) && !isnan(hum))
   {
-     if (tempUnit == TempUnit_Celsius)
+     float ctemp = temp;
+     if (tempUnit != TempUnit_Celsius)
      {
-       dewPoint = 243.04 * (log(hum/100.0) + ((17.625 * temp)/(243.04 + temp)))
-       /(17.625 - log(hum/100.0) - ((17.625 * temp)/(243.04 + temp)));
+       ctemp = (temp - 32.0) * 5.0/9.0;
      }
-     else
-     {
-       float ctemp = (temp - 32.0) * 5.0/9.0;
 
-       dewPoint = 243.04 * (log(hum/100.0) + ((17.625 * ctemp)/(243.04 + ctemp)))
-       /(17.625 - log(hum/100.0) - ((17.625 * ctemp)/(243.04 + ctemp)));
+     double gamma = LogDouble(hum/100.0) + ((17.625 * ctemp)/(243.04 + ctemp));
+     dewPoint = 243.04 * gamma / (17.625 - gamma);
 
+     if (tempUnit != TempUnit_Celsius)
+     {
        dewPoint = dewPoint * 9.0/5.0 + 32.0;
      }
   }
 
   return dewPoint;
 }
+
+
+/****************************************************************/
+EnvironmentCalculations::Metrics EnvironmentCalculations::DerivedMetrics
+(
+  float temp,
+  float hum,
+  float pres,
+  TempUnit tempUnit,
+  AltitudeUnit altUnit,
+  float referencePressure,
+  float outdoorTemp
+)
+{
+  const float mw = 18.01534; 	// molar mass of water g/mol
+  const float r = 8.31447215; 	// Universal gas constant J/mol/K
+
+  Metrics metrics;
+
+  // The ISA temperature, 15 °C, whatever the unit of temp.
+  if(isnan(outdoorTemp))
+  {
+    outdoorTemp = tempUnit == TempUnit_Celsius ? 15.0f : 59.0f;
+  }
+
+  float ctemp = temp;
+  float ftemp = temp;
+  if(tempUnit == TempUnit_Celsius)
+  {
+    ftemp = temp * (9.0f / 5.0f) + 32.0f; /*conversion to [°F]*/
+  }
+  else
+  {
+    ctemp = (temp - 32.0f) * (5.0f / 9.0f); /*conversion to [°C]*/
+    outdoorTemp = (outdoorTemp - 32.0f) * (5.0f / 9.0f);
+  }
+
+  // August-Roche-Magnus, shared by the dew point and the absolute humidity.
+  float magnus = (17.625f * ctemp) / (243.04f + ctemp);
+  metrics.saturationVaporPressure = 6.1094f * Exp(magnus);
+
+  float gamma = Log(hum * 0.01f) + magnus;
+  float dewPoint = 243.04f * gamma / (17.625f - gamma);
+
+  metrics.absoluteHumidity = (metrics.saturationVaporPressure * hum * mw) / ((273.15f + ctemp) * r);
+
+  float heatIndex = HeatIndexFahrenheit(ftemp, hum);
+
+  if(tempUnit == TempUnit_Celsius)
+  {
+    metrics.dewPoint = dewPoint;
+    metrics.heatIndex = (heatIndex - 32.0f) * (5.0f / 9.0f); /*conversion back to [°C]*/
+  }
+  else
+  {
+    metrics.dewPoint = dewPoint * (9.0f / 5.0f) + 32.0f;
+    metrics.heatIndex = heatIndex;
+  }
+
+  metrics.altitude = Pow(referencePressure / pres, 0.190234f) - 1;
+  metrics.altitude *= ((outdoorTemp + 273.15f) / 0.0065f);
+  if(altUnit != AltitudeUnit_Meters)  metrics.altitude *= 3.28084f;
+
+  return metrics;
+}
+
+
+/****************************************************************/
+void EnvironmentCalculations::Altitude
+(
+  const float pressure[],
+  float altitude[],
+  size_t count,
+  AltitudeUnit altUnit,
+  float referencePressure,
+  float outdoorTemp,
+  TempUnit tempUnit
+)
+{
+  if(tempUnit != TempUnit_Celsius)
+      outdoorTemp = (outdoorTemp - 32.0f) * (5.0f / 9.0f); /*conversion to [°C]*/
+
+  // altitude = scale * ((referencePressure / pressure)^k - 1)
+  //          = scale * referencePressure^k * pressure^-k - scale
+  float scale = (outdoorTemp + 273.15f) / 0.0065f;
+  if(altUnit != AltitudeUnit_Meters)  scale *= 3.28084f;
+  const float refScale = scale * Pow(referencePressure, 0.190234f);
+
+  for(size_t i = 0; i < count; ++i)
+  {
+    altitude[i] = refScale * Pow(pressure[i], -0.190234f) - scale;
+  }
+}
+
+
+/****************************************************************/
+void EnvironmentCalculations::HeatIndex
+(
+  const float temperature[],
+  const float humidity[],
+  float heatIndex[],
+  size_t count,
+  TempUnit tempUnit
+)
+{
+  // Linear conversion to [°F] and back, selected once for the batch.
+  float toF = 1.0f, toFOffset = 0.0f;
+  if (tempUnit == TempUnit_Celsius)
+  {
+    toF = 9.0f / 5.0f;
+    toFOffset = 32.0f;
+  }
+  const float fromF = 1.0f / toF;
+
+  for(size_t i = 0; i < count; ++i)
+  {
+    float temp = temperature[i] * toF + toFOffset;
+    heatIndex[i] = (HeatIndexFahrenheit(temp, humidity[i]) - toFOffset) * fromF;
+  }
+}
+
+
+/****************************************************************/
+void EnvironmentCalculations::AbsoluteHumidity
+(
+  const float temperature[],
+  const float humidity[],
+  float absoluteHumidity[],
+  size_t count,
+  TempUnit tempUnit
+)
+{
+  const float mw = 18.01534; 	// molar mass of water g/mol
+  const float r = 8.31447215; 	// Universal gas constant J/mol/K
+  const float factor = 6.112f * mw / r;
+
+  float toC = 1.0f, toCOffset = 0.0f;
+  if(tempUnit != TempUnit_Celsius)
+  {
+    toC = 5.0f / 9.0f;
+    toCOffset = -32.0f * (5.0f / 9.0f);
+  }
+
+  for(size_t i = 0; i < count; ++i)
+  {
+    float temp = temperature[i] * toC + toCOffset;
+    float es = Exp((17.67f * temp) / (temp + 243.5f));
+    absoluteHumidity[i] = (factor * es * humidity[i]) / (273.15f + temp);
+  }
+}
+
+
+/****************************************************************/
+void EnvironmentCalculations::EquivalentSeaLevelPressure
+(
+  float altitude,
+  const float temp[],
+  const float pres[],
+  float seaLevelPressure[],
+  size_t count,
+  AltitudeUnit altUnit,
+  TempUnit tempUnit
+)
+{
+  if(altUnit != AltitudeUnit_Meters)
+      altitude *= 0.3048f; /*conversion to meters*/
+
+  const float lapse = 0.0065f * altitude;
+  // temp + lapse + 273.15 with the unit conversion folded in.
+  float toK = 1.0f, toKOffset = lapse + 273.15f;
+  if(tempUnit != TempUnit_Celsius)
+  {
+    toK = 5.0f / 9.0f;
+    toKOffset -= 32.0f * (5.0f / 9.0f);
+  }
+
+  for(size_t i = 0; i < count; ++i)
+  {
+    float base = 1.0f - lapse / (temp[i] * toK + toKOffset);
+    seaLevelPressure[i] = pres[i] * Pow(base, -5.257f);
+  }
+}
+
+
+/****************************************************************/
+void EnvironmentCalculations::DewPoint
+(
+  const float temp[],
+  const float hum[],
+  float dewPoint[],
+  size_t count,
+  TempUnit tempUnit
+)
+{
+  // Equations courtesy of Brian McNoldy from http://andrew.rsmas.miami.edu;
+  float toC = 1.0f, toCOffset = 0.0f;
+  if(tempUnit != TempUnit_Celsius)
+  {
+    toC = 5.0f / 9.0f;
+    toCOffset = -32.0f * (5.0f / 9.0f);
+  }
+  const float fromC = 1.0f / toC;
+
+  for(size_t i = 0; i < count; ++i)
+  {
+    float ctemp = temp[i] * toC + toCOffset;
+    float gamma = Log(hum[i] * 0.01f) + (17.625f * ctemp) / (243.04f + ctemp);
+    float dp = 243.04f * gamma / (17.625f - gamma);
+    dewPoint[i] = (dp - toCOffset) * fromC;
+  }
+}
+
+
+/****************************************************************/
+// log2(x) in Q8.24 by repeated squaring of the mantissa, INT32_MIN
+// for x = 0.
+static int32_t Log2Fixed
+(
+  uint32_t x
+)
+{
+  if(x == 0)
+  {
+    return INT32_MIN;
+  }
+
+  // Normalize x to m in [1, 2) as Q2.30.
+  int32_t e = 30;
+  while(x < ((uint32_t)1 << 30)) { x <<= 1; --e; }
+  while(x >= ((uint32_t)1 << 31)) { x >>= 1; ++e; }
+
+  int32_t result = e * ((int32_t)1 << 24);
+  uint32_t m = x;
+  for(int32_t bit = (int32_t)1 << 23; bit != 0; bit >>= 1)
+  {
+    m = (uint32_t)(((uint64_t)m * m) >> 30);
+    if(m >= ((uint32_t)1 << 31))
+    {
+      m >>= 1;
+      result += bit;
+    }
+  }
+  return result;
+}
+
+
+/****************************************************************/
+// 2^y in Q34.30 for y in Q8.24, -30 < y < 33.
+static uint64_t Exp2Fixed
+(
+  int32_t y
+)
+{
+  int32_t n = y >> 24;
+  uint64_t f = (uint64_t)(y & 0x00FFFFFF) << 6;  // Q2.30 in [0, 1)
+
+  // 2^f, Chebyshev fit of degree 6 on [0, 1], coefficients in Q2.30.
+  uint64_t p = 234782;
+  p = ((p * f) >> 30) + 1330509;
+  p = ((p * f) >> 30) + 10398316;
+  p = ((p * f) >> 30) + 59571873;
+  p = ((p * f) >> 30) + 257945486;
+  p = ((p * f) >> 30) + 744260852;
+  p = ((p * f) >> 30) + 1073741827;
+
+  return n >= 0 ? p << n : p >> -n;
+}
+
+
+/****************************************************************/
+int32_t EnvironmentCalculations::DewPointFixed
+(
+  int32_t temp,
+  uint32_t hum
+)
+{
+  if(hum == 0)
+  {
+    return INT32_MIN;
+  }
+
+  // gamma = ln(hum / 102400) + 17.625 * T / (243.04 + T), in Q8.24.
+  // ln(2) is 744261118 in Q2.30.
+  int64_t lnHum = ((int64_t)(Log2Fixed(hum) - Log2Fixed(102400)) * 744261118) >> 30;
+  int64_t magnus = ((int64_t)17625 * temp * ((int64_t)1 << 24)) / ((int64_t)(24304 + temp) * 1000);
+  int64_t gamma = lnHum + magnus;
+
+  // 243.04 * gamma / (17.625 - gamma), rounded from 1/256 of 0.01 °C.
+  int64_t dewPoint = ((int64_t)24304 * 256 * gamma) / ((((int64_t)17625 << 24) / 1000) - gamma);
+  return (int32_t)((dewPoint + 128) >> 8);
+}
+
+
+/****************************************************************/
+uint32_t EnvironmentCalculations::AbsoluteHumidityFixed
+(
+  int32_t temp,
+  uint32_t hum
+)
+{
+  // exp(17.67 * T / (T + 243.5)) = 2^(17.67 * T / (T + 243.5) * log2(e)),
+  // log2(e) is 1549082005 in Q2.30.
+  int64_t x = ((int64_t)17670 * temp * ((int64_t)1 << 24)) / ((int64_t)(24350 + temp) * 1000);
+  uint64_t e = Exp2Fixed((int32_t)((x * 1549082005) >> 30));
+
+  // 6.112 * e * hum * mw / ((273.15 + T) * r) in mg/m³ with hum in %RH * 1024:
+  // 6.112 * 18.01534 / 8.31447215 * 1000 * 100 / 1024 = 1293.28, 331079 in Q8.
+  return (uint32_t)((((e >> 14) * hum * 331079) / (uint32_t)(27315 + temp)) >> 24);
+}
+
+
+/****************************************************************/
+int32_t EnvironmentCalculations::AltitudeFixed
+(
+  uint32_t pressure,
+  uint32_t referencePressure,
+  int32_t outdoorTemp
+)
+{
+  if(pressure == 0 || referencePressure == 0 || outdoorTemp <= -27315)
+  {
+    return INT32_MIN;
+  }
+
+  // Equation inverse to EquivalentSeaLevelPressure calculation.
+  // (referencePressure / pressure)^0.190234, 0.190234 is 204262202 in Q2.30.
+  int64_t ratio = Log2Fixed(referencePressure) - Log2Fixed(pressure);
+  int64_t power = (int64_t)Exp2Fixed((int32_t)((ratio * 204262202) >> 30)) - ((int64_t)1 << 30);
+
+  // (T + 273.15) / 0.0065 in cm with T in 0.01 °C.
+  int64_t scale = ((int64_t)(outdoorTemp + 27315) * 2000) / 13;
+
+  return (int32_t)((power * scale) >> 30);
+}
+
+
+/****************************************************************/
+uint32_t EnvironmentCalculations::EquivalentSeaLevelPressureFixed
+(
+  int32_t altitude,
+  int32_t temp,
+  uint32_t pres
+)
+{
+  // 1 / (1 - L / (T + L + 273.15))^5.257 = ((T + 273.15 + L) / (T + 273.15))^5.257
+  // with L = 0.0065 * altitude. Both terms scaled by 200000 per K keep L exact.
+  if(temp <= -27315)
+  {
+    return 0;
+  }
+
+  uint32_t kelvin = (uint32_t)(temp + 27315) * 2000;
+  uint32_t lapse = (uint32_t)altitude * 13;
+  if(kelvin + lapse == 0)
+  {
+    return 0;
+  }
+
+  // 5.257 is 5644660769 in Q2.30.
+  int64_t ratio = Log2Fixed(kelvin + lapse) - Log2Fixed(kelvin);
+  uint64_t factor = Exp2Fixed((int32_t)((ratio * 5644660769LL) >> 30));
+
+  return (uint32_t)((factor * pres) >> 30);
+}
+
+
+/****************************************************************/
+EnvironmentCalculations::AltitudeCalculator::AltitudeCalculator
+(
+  float referencePressure,
+  float outdoorTemp,
+  AltitudeUnit altUnit,
+  TempUnit tempUnit
+):m_altUnit(altUnit),
+  m_seaLevelFactor(1),
+  m_stationAltitude(0),
+  m_table(NULL),
+  m_tableSize(0),
+  m_tableMin(0),
+  m_tableStep(0),
+  m_tableInvStep(0)
+{
+  setReference(referencePressure, outdoorTemp, tempUnit);
+}
+
+
+/****************************************************************/
+void EnvironmentCalculations::AltitudeCalculator::setReference
+(
+  float referencePressure,
+  float outdoorTemp,
+  TempUnit tempUnit
+)
+{
+  if(tempUnit != TempUnit_Celsius)
+      outdoorTemp = (outdoorTemp - 32.0f) * (5.0f / 9.0f); /*conversion to [°C]*/
+
+  m_outdoorTemp = outdoorTemp;
+
+  m_scale = (outdoorTemp + 273.15f) / 0.0065f;
+  if(m_altUnit != AltitudeUnit_Meters)  m_scale *= 3.28084f;
+  m_refScale = m_scale * Pow(referencePressure, 0.190234f);
+
+  UpdateSeaLevelFactor();
+
+  if(m_table != NULL)
+  {
+    FillTable();
+  }
+}
+
+
+/****************************************************************/
+void EnvironmentCalculations::AltitudeCalculator::setStationAltitude
+(
+  float altitude
+)
+{
+  if(m_altUnit != AltitudeUnit_Meters)
+      altitude *= 0.3048f; /*conversion to meters*/
+
+  m_stationAltitude = altitude;
+
+  UpdateSeaLevelFactor();
+}
+
+
+/****************************************************************/
+void EnvironmentCalculations::AltitudeCalculator::UpdateSeaLevelFactor()
+{
+  const float lapse = 0.0065f * m_stationAltitude;
+  m_seaLevelFactor = Pow(1.0f - lapse / (m_outdoorTemp + lapse + 273.15f), -5.257f);
+}
+
+
+/****************************************************************/
+bool EnvironmentCalculations::AltitudeCalculator::setTable
+(
+  float table[],
+  uint16_t size,
+  float minPressure,
+  float maxPressure
+)
+{
+  m_table = NULL;
+
+  if(table == NULL || size < 2 || !(maxPressure > minPressure) || !(minPressure > 0))
+  {
+    return false;
+  }
+
+  m_table = table;
+  m_tableSize = size;
+  m_tableMin = minPressure;
+  m_tableStep = (maxPressure - minPressure) / (size - 1);
+  m_tableInvStep = 1.0f / m_tableStep;
+
+  FillTable();
+
+  return true;
+}
+
+
+/****************************************************************/
+void EnvironmentCalculations::AltitudeCalculator::FillTable()
+{
+  for(uint16_t i = 0; i < m_tableSize; ++i)
+  {
+    m_table[i] = AltitudeFormula(m_tableMin + i * m_tableStep);
+  }
+}
+
+
+/****************************************************************/
+float EnvironmentCalculations::AltitudeCalculator::AltitudeFormula
+(
+  float pressure
+) const
+{
+  return m_refScale * Pow(pressure, -0.190234f) - m_scale;
+}
+
+
+/****************************************************************/
+float EnvironmentCalculations::AltitudeCalculator::altitude
+(
+  float pressure
+) const
+{
+  if(m_table != NULL)
+  {
+    float position = (pressure - m_tableMin) * m_tableInvStep;
+    if(position >= 0 && position < m_tableSize - 1)
+    {
+      uint16_t index = (uint16_t)position;
+      float fraction = position - index;
+      return m_table[index] + fraction * (m_table[index + 1] - m_table[index]);
+    }
+  }
+
+  return AltitudeFormula(pressure);
+}
+
+
+/****************************************************************/
+void EnvironmentCalculations::AltitudeCalculator::altitude
+(
+  const float pressure[],
+  float altitude[],
+  size_t count
+) const
+{
+  if(m_table != NULL)
+  {
+    for(size_t i = 0; i < count; ++i)
+    {
+      altitude[i] = this->altitude(pressure[i]);
+    }
+    return;
+  }
+
+  const float refScale = m_refScale;
+  const float scale = m_scale;
+  for(size_t i = 0; i < count; ++i)
+  {
+    altitude[i] = refScale * Pow(pressure[i], -0.190234f) - scale;
+  }
+}
+
+
+/****************************************************************/
+float EnvironmentCalculations::AltitudeCalculator::seaLevelPressure
+(
+  float pressure
+) const
+{
+  return pressure * m_seaLevelFactor;
+}
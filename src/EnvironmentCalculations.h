@@ -30,6 +30,25 @@ This header must be included in any derived code or copies of the code.
 #ifndef TG_ENVIRONMENT_CALCULATIONS_H
 #define TG_ENVIRONMENT_CALCULATIONS_H
 
+#include <math.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/////////////////////////////////////////////////////////////////
+/// Define ENVIRONMENT_CALCULATIONS_FAST_MATH when building the
+/// library to evaluate every calculation with FastLog, FastExp and
+/// FastPow instead of libm. The polynomials are only as long as
+/// the error budget needs: 0.01°C of dew point, and a fraction of
+/// the sensor's ±0.12hPa (about ±1m) relative pressure accuracy.
+/// Maximum errors against double precision over the sensor range
+/// (-40..85°C, 1..100%RH, 300..1100hPa):
+///   DewPoint                    0.001 °C
+///   AbsoluteHumidity            0.001 %
+///   Altitude                    0.5 m
+///   EquivalentSeaLevelPressure  0.01 %
+/// The Environment_Calculations_FastMath example sweeps them on the
+/// target.
+
 namespace EnvironmentCalculations
 {
   /////////////////////////////////////////////////////////////////
@@ -124,6 +143,294 @@ namespace EnvironmentCalculations
     float hum,
     TempUnit tempUnit = TempUnit_Celsius);
 
+  /////////////////////////////////////////////////////////////////
+  /// Metrics derived from one temperature/humidity/pressure sample.
+  struct Metrics
+  {
+    float dewPoint;                  // in tempUnit
+    float absoluteHumidity;          // [g/m³]
+    float heatIndex;                 // in tempUnit
+    float altitude;                  // in altUnit
+    float saturationVaporPressure;   // [hPa]
+  };
+
+  /////////////////////////////////////////////////////////////////
+  /// Calculate all derived metrics of a sample in one pass. The
+  /// unit conversions and the Magnus saturation vapor pressure are
+  /// evaluated once and shared, one log and one exp per sample
+  /// instead of the separate functions' own terms. Dew point and
+  /// absolute humidity both use the August-Roche-Magnus constants
+  /// of DewPoint, so absoluteHumidity is within 0.6% of
+  /// AbsoluteHumidity() over -40..85°C.
+  /// @param temp in tempUnit.
+  /// @param hum in %.
+  /// @param pres at the station in the unit of referencePressure.
+  /// @param tempUnit in °C or °F. default=TempUnit_Celsius
+  /// @param altUnit meters or feet. default=AltitudeUnit_Meters
+  /// @param referencePressure (usually pressure on MSL)
+  ///          default=1013.25hPa (ISA)
+  /// @param outdoorTemp temperature at the station in tempUnit used
+  ///          for the altitude. default=NAN, 15°C (ISA) in either
+  ///          tempUnit
+  Metrics DerivedMetrics(
+    float temp,
+    float hum,
+    float pres,
+    TempUnit tempUnit = TempUnit_Celsius,
+    AltitudeUnit altUnit = AltitudeUnit_Meters,
+    float referencePressure = 1013.25,   // [hPa] ....ISA value
+    float outdoorTemp = NAN);            // [tempUnit] .... NAN: ISA value
+
+
+/*****************************************************************/
+/* FAST MATH FUNCTIONS                                           */
+/*****************************************************************/
+
+  /////////////////////////////////////////////////////////////////
+  /// Polynomial approximation of the natural logarithm for IEEE 754
+  /// floats. Absolute error below 2e-5 for x in [0.001, 1000].
+  float FastLog(
+    float x);
+
+  /////////////////////////////////////////////////////////////////
+  /// Polynomial approximation of e^x for IEEE 754 floats. Relative
+  /// error below 4e-6 for x in [-10, 10]. Saturates to infinity
+  /// above 88 and to zero below -86.6.
+  float FastExp(
+    float x);
+
+  /////////////////////////////////////////////////////////////////
+  /// FastExp(y * FastLog(x)) for x > 0. The relative error is
+  /// about 2e-5 * |y| + 4e-6 in the range of the calculations.
+  float FastPow(
+    float x,
+    float y);
+
+
+/*****************************************************************/
+/* BATCH FUNCTIONS                                               */
+/*****************************************************************/
+
+  /////////////////////////////////////////////////////////////////
+  /// Calculate the altitude for an array of pressure samples.
+  /// The reference dependent terms are evaluated once per batch.
+  /// @param pressure array of pressures at the station in any units.
+  /// @param altitude array receiving count altitudes in altUnit.
+  /// @param count number of samples.
+  /// @see Altitude(float, AltitudeUnit, float, float, TempUnit)
+  void Altitude(
+    const float pressure[],
+    float altitude[],
+    size_t count,
+    AltitudeUnit altUnit = AltitudeUnit_Meters,
+    float referencePressure = 1013.25,   // [hPa] ....ISA value
+    float outdoorTemp = 15,              // [°C] .... ISA value
+    TempUnit tempUnit = TempUnit_Celsius);
+
+  /////////////////////////////////////////////////////////////////
+  /// Calculate the heat index for arrays of temperature and
+  /// humidity samples.
+  /// @param heatIndex array receiving count heat indices in tempUnit.
+  /// @see HeatIndex(float, float, TempUnit)
+  void HeatIndex(
+    const float temperature[],
+    const float humidity[],
+    float heatIndex[],
+    size_t count,
+    TempUnit tempUnit = TempUnit_Celsius);
+
+  /////////////////////////////////////////////////////////////////
+  /// Calculate the absolute humidity for arrays of temperature and
+  /// humidity samples.
+  /// @param absoluteHumidity array receiving count values in grams/m³.
+  /// @see AbsoluteHumidity(float, float, TempUnit)
+  void AbsoluteHumidity(
+    const float temperature[],
+    const float humidity[],
+    float absoluteHumidity[],
+    size_t count,
+    TempUnit tempUnit = TempUnit_Celsius);
+
+  /////////////////////////////////////////////////////////////////
+  /// Convert an array of station pressures to equivalent sea-level
+  /// pressures for a station at a fixed altitude.
+  /// @param seaLevelPressure array receiving count pressures in the
+  ///          unit of pres.
+  /// @see EquivalentSeaLevelPressure(float, float, float, AltitudeUnit, TempUnit)
+  void EquivalentSeaLevelPressure(
+    float altitude,
+    const float temp[],
+    const float pres[],
+    float seaLevelPressure[],
+    size_t count,
+    AltitudeUnit altUnit = AltitudeUnit_Meters,
+    TempUnit tempUnit = TempUnit_Celsius);
+
+  /////////////////////////////////////////////////////////////////
+  /// Calculate the dew point for arrays of temperature and humidity
+  /// samples.
+  /// @param dewPoint array receiving count dew points in tempUnit.
+  /// @see DewPoint(float, float, TempUnit)
+  void DewPoint(
+    const float temp[],
+    const float hum[],
+    float dewPoint[],
+    size_t count,
+    TempUnit tempUnit = TempUnit_Celsius);
+
+
+/*****************************************************************/
+/* FIXED POINT FUNCTIONS                                         */
+/*****************************************************************/
+
+  // Integer versions of the calculations for builds without floating
+  // point. Inputs are the integer outputs of the Bosch compensation,
+  // see BME280::read(uint32_t&, int32_t&, uint32_t&).
+
+  /////////////////////////////////////////////////////////////////
+  /// Calculate the dew point without floating point.
+  /// @param temp in 0.01 °C.
+  /// @param hum in %RH * 1024.
+  /// @return dew point in 0.01 °C, INT32_MIN if hum is 0.
+  int32_t DewPointFixed(
+    int32_t temp,
+    uint32_t hum);
+
+  /////////////////////////////////////////////////////////////////
+  /// Calculate the absolute humidity without floating point.
+  /// @param temp in 0.01 °C.
+  /// @param hum in %RH * 1024.
+  /// @return absolute humidity in milligrams/m³.
+  uint32_t AbsoluteHumidityFixed(
+    int32_t temp,
+    uint32_t hum);
+
+  /////////////////////////////////////////////////////////////////
+  /// Calculate the altitude without floating point.
+  /// @param pressure at the station in any units.
+  /// @param referencePressure (usually pressure on MSL)
+  ///          in the same units as pressure. default=101325Pa (ISA)
+  /// @param outdoorTemp temperature at the station in 0.01 °C.
+  ///          default=15°C (ISA)
+  /// @return altitude in centimeters, INT32_MIN if a pressure is 0
+  ///          or outdoorTemp is not above absolute zero.
+  int32_t AltitudeFixed(
+    uint32_t pressure,
+    uint32_t referencePressure = 101325,   // [Pa] ....ISA value
+    int32_t outdoorTemp = 1500);           // [0.01°C] .... ISA value
+
+  /////////////////////////////////////////////////////////////////
+  /// Convert current pressure to equivalent sea-level pressure
+  /// without floating point.
+  /// @param altitude in centimeters, 0 to 1000000.
+  /// @param temp in 0.01 °C.
+  /// @param pres at the station in any units below 2^32 / 4.
+  /// @return Equivalent pressure at sea level in the unit of pres,
+  ///          0 if temp is not above absolute zero.
+  uint32_t EquivalentSeaLevelPressureFixed(
+    int32_t altitude,
+    int32_t temp,
+    uint32_t pres);
+
+
+/*****************************************************************/
+/* ALTITUDE CALCULATOR                                           */
+/*****************************************************************/
+
+  /////////////////////////////////////////////////////////////////
+  /// Altitude and sea-level pressure for a fixed reference.
+  ///
+  /// Everything derived from the reference pressure, outdoor
+  /// temperature and station altitude is computed when they are
+  /// set, so altitude() costs one pow per sample, or an interpolated
+  /// table lookup when a table is attached, and seaLevelPressure()
+  /// a single multiply.
+  class AltitudeCalculator
+  {
+  public:
+
+    /////////////////////////////////////////////////////////////////
+    /// @param referencePressure (usually pressure on MSL), the unit
+    ///          of every pressure passed to this object.
+    /// @param outdoorTemp temperature at the station in tempUnit.
+    /// @param altUnit meters or feet, for altitudes in and out.
+    /// @param tempUnit in °C or °F.
+    AltitudeCalculator(
+      float referencePressure = 1013.25,   // [hPa] ....ISA value
+      float outdoorTemp = 15,              // [°C] .... ISA value
+      AltitudeUnit altUnit = AltitudeUnit_Meters,
+      TempUnit tempUnit = TempUnit_Celsius);
+
+    /////////////////////////////////////////////////////////////////
+    /// Change the reference. Rebuilds the table if one is attached.
+    void setReference(
+      float referencePressure,
+      float outdoorTemp,
+      TempUnit tempUnit = TempUnit_Celsius);
+
+    /////////////////////////////////////////////////////////////////
+    /// Set the station altitude in altUnit used by seaLevelPressure().
+    void setStationAltitude(
+      float altitude);
+
+    /////////////////////////////////////////////////////////////////
+    /// Attach a caller owned table of size entries covering
+    /// minPressure to maxPressure, and fill it for the current
+    /// reference. altitude() then interpolates linearly inside the
+    /// range and falls back to the formula outside of it. With 256
+    /// entries over 300-1100hPa the interpolation error is below
+    /// 0.2m. Pass a null table to detach.
+    /// @return true if the table was attached.
+    bool setTable(
+      float table[],
+      uint16_t size,
+      float minPressure = 300,             // [hPa]
+      float maxPressure = 1100);           // [hPa]
+
+    /////////////////////////////////////////////////////////////////
+    /// @return the altitude in altUnit for the station pressure.
+    float altitude(
+      float pressure) const;
+
+    /////////////////////////////////////////////////////////////////
+    /// Calculate count altitudes in altUnit from station pressures.
+    void altitude(
+      const float pressure[],
+      float altitude[],
+      size_t count) const;
+
+    /////////////////////////////////////////////////////////////////
+    /// @return the equivalent sea-level pressure for a pressure
+    ///          measured at the station altitude.
+    float seaLevelPressure(
+      float pressure) const;
+
+  private:
+
+    float AltitudeFormula(
+      float pressure) const;
+
+    void FillTable();
+
+    void UpdateSeaLevelFactor();
+
+    AltitudeUnit m_altUnit;
+    float m_outdoorTemp;        // [°C]
+
+    // altitude = m_refScale * pressure^-k - m_scale
+    float m_scale;
+    float m_refScale;
+
+    float m_seaLevelFactor;
+    float m_stationAltitude;    // [m]
+
+    float* m_table;
+    uint16_t m_tableSize;
+    float m_tableMin;
+    float m_tableStep;
+    float m_tableInvStep;
+  };
+
 }
 
 #endif // TG_ENVIRONMENT_CALCULATIONS_H